@@ -0,0 +1,282 @@
+#include "../src/compiler/lexer.h"
+#include "../src/compiler/parser.h"
+#include "../src/compiler/semantic_analyzer.h"
+#include "../src/compiler/module_loader.h"
+#include "../src/runtime/compiler.h"
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <sys/stat.h>
+
+using namespace Tick;
+
+static const int BENCH_REPS = 5;
+static const char* BENCH_DIR = "/tmp/tick_bench";
+static const char* BASELINE_FILE = "benchmarks/compiler_baseline.txt";
+
+struct BenchResult {
+    char name[128];
+    double ms;
+};
+
+static BenchResult results[64];
+static int result_count = 0;
+
+static double now_ms() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1000000.0;
+}
+
+static void append_line(char* buf, size_t cap, size_t* len, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    int written = vsnprintf(buf + *len, cap - *len, fmt, args);
+    va_end(args);
+    if (written > 0) *len += (size_t)written;
+}
+
+static char* gen_functions(int n, size_t* out_len) {
+    size_t cap = (size_t)n * 256 + 1024;
+    char* buf = (char*)malloc(cap);
+    size_t len = 0;
+    for (int i = 0; i < n; i++) {
+        append_line(buf, cap, &len,
+            "func fn%d(a : i32, b : i32) : i32 {\n"
+            "    var x : i32 = a * 3 + b;\n"
+            "    var y : i32 = x + %d;\n"
+            "    return x + y;\n"
+            "}\n\n", i, i);
+    }
+    append_line(buf, cap, &len,
+        "func main() : i32 {\n    return fn0(1, 2);\n}\n");
+    *out_len = len;
+    return buf;
+}
+
+static char* gen_classes(int n, size_t* out_len) {
+    size_t cap = (size_t)n * 384 + 1024;
+    char* buf = (char*)malloc(cap);
+    size_t len = 0;
+    for (int i = 0; i < n; i++) {
+        append_line(buf, cap, &len,
+            "class C%d {\n"
+            "    var x : i32;\n"
+            "    var y : i32;\n"
+            "    func C%d(px : i32) : void {\n"
+            "        this.x = px;\n"
+            "        this.y = px * 2;\n"
+            "    }\n"
+            "    func total() : i32 {\n"
+            "        return this.x + this.y;\n"
+            "    }\n"
+            "}\n\n", i, i);
+    }
+    append_line(buf, cap, &len,
+        "func main() : i32 {\n    var c : C0 = C0(1);\n    return c.total();\n}\n");
+    *out_len = len;
+    return buf;
+}
+
+static char* gen_deep_expr(int depth, size_t* out_len) {
+    size_t cap = (size_t)depth * 16 + 1024;
+    char* buf = (char*)malloc(cap);
+    size_t len = 0;
+    append_line(buf, cap, &len, "func main() : i32 {\n    var x : i32 = ");
+    for (int i = 0; i < depth; i++) {
+        append_line(buf, cap, &len, "(1 + ");
+    }
+    append_line(buf, cap, &len, "0");
+    for (int i = 0; i < depth; i++) {
+        append_line(buf, cap, &len, ")");
+    }
+    append_line(buf, cap, &len, ";\n    return x - %d;\n}\n", depth);
+    *out_len = len;
+    return buf;
+}
+
+static char* gen_module_scenario(int modules, size_t* out_len) {
+    char mod_dir[256];
+    snprintf(mod_dir, sizeof(mod_dir), "%s/modules", BENCH_DIR);
+    mkdir(mod_dir, 0755);
+    for (int i = 0; i < modules; i++) {
+        char path[320];
+        snprintf(path, sizeof(path), "%s/bench_mod%d.tick", mod_dir, i);
+        FILE* f = fopen(path, "w");
+        if (!f) continue;
+        fprintf(f,
+            "const MOD%d_VALUE : i32 = %d;\n\n"
+            "func mod%d_calc(a : i32) : i32 {\n"
+            "    return a * MOD%d_VALUE + %d;\n"
+            "}\n", i, i, i, i, i);
+        fclose(f);
+    }
+
+    size_t cap = (size_t)modules * 128 + 1024;
+    char* buf = (char*)malloc(cap);
+    size_t len = 0;
+    for (int i = 0; i < modules; i++) {
+        append_line(buf, cap, &len, "from bench_mod%d import *;\n", i);
+    }
+    append_line(buf, cap, &len,
+        "\nfunc main() : i32 {\n    return mod0_calc(1) - %d;\n}\n", 0);
+    *out_len = len;
+    return buf;
+}
+
+static void record(const char* scenario, const char* stage, double ms,
+                   size_t bytes, size_t tokens) {
+    double mb_per_s = ms > 0.0 ? ((double)bytes / 1048576.0) / (ms / 1000.0) : 0.0;
+    double ns_per_tok = tokens > 0 ? (ms * 1000000.0) / (double)tokens : 0.0;
+    BenchResult* r = &results[result_count++];
+    snprintf(r->name, sizeof(r->name), "%s.%s", scenario, stage);
+    r->ms = ms;
+    printf("  %-10s %10.3f ms  %8.1f MB/s  %8.1f ns/tok\n",
+        stage, ms, mb_per_s, ns_per_tok);
+}
+
+static void bench_scenario(const char* scenario, const char* source,
+                           size_t source_len, const char* source_path) {
+    printf("%s (%zu bytes)\n", scenario, source_len);
+
+    double best = 1e30;
+    size_t token_count = 0;
+    for (int rep = 0; rep < BENCH_REPS; rep++) {
+        double t0 = now_ms();
+        Lexer lexer(source);
+        DynamicArray<Token> tokens = lexer.tokenize();
+        double t1 = now_ms();
+        token_count = tokens.size();
+        if (t1 - t0 < best) best = t1 - t0;
+    }
+    record(scenario, "lex", best, source_len, token_count);
+
+    Lexer lexer(source);
+    DynamicArray<Token> tokens = lexer.tokenize();
+
+    best = 1e30;
+    for (int rep = 0; rep < BENCH_REPS; rep++) {
+        double t0 = now_ms();
+        Parser parser(tokens);
+        Program* program = parser.parse();
+        double t1 = now_ms();
+        delete program;
+        if (t1 - t0 < best) best = t1 - t0;
+    }
+    record(scenario, "parse", best, source_len, token_count);
+
+    best = 1e30;
+    for (int rep = 0; rep < BENCH_REPS; rep++) {
+        Parser parser(tokens);
+        Program* program = parser.parse();
+        ModuleLoader loader;
+        loader.preload(program, source_path);
+        SemanticAnalyzer analyzer;
+        analyzer.set_module_loader(&loader);
+        analyzer.set_current_file_path(source_path);
+        double t0 = now_ms();
+        if (!analyzer.analyze(program)) {
+            fprintf(stderr, "%s: semantic analysis failed\n", scenario);
+            delete program;
+            return;
+        }
+        double t1 = now_ms();
+        delete program;
+        if (t1 - t0 < best) best = t1 - t0;
+    }
+    record(scenario, "sema", best, source_len, token_count);
+
+    best = 1e30;
+    for (int rep = 0; rep < BENCH_REPS; rep++) {
+        Parser parser(tokens);
+        Program* program = parser.parse();
+        ModuleLoader loader;
+        loader.preload(program, source_path);
+        SemanticAnalyzer analyzer;
+        analyzer.set_module_loader(&loader);
+        analyzer.set_current_file_path(source_path);
+        analyzer.analyze(program);
+        double t0 = now_ms();
+        Compiler::generate_c_to_file(program, "/dev/null");
+        double t1 = now_ms();
+        delete program;
+        if (t1 - t0 < best) best = t1 - t0;
+    }
+    record(scenario, "codegen", best, source_len, token_count);
+}
+
+static void run_scenario(const char* scenario, char* source, size_t source_len) {
+    char source_path[320];
+    snprintf(source_path, sizeof(source_path), "%s/%s.tick", BENCH_DIR, scenario);
+    FILE* f = fopen(source_path, "w");
+    if (f) {
+        fwrite(source, 1, source_len, f);
+        fclose(f);
+    }
+    bench_scenario(scenario, source, source_len, source_path);
+    free(source);
+}
+
+static void compare_baseline(bool save) {
+    if (save) {
+        FILE* f = fopen(BASELINE_FILE, "w");
+        if (!f) {
+            fprintf(stderr, "Cannot write %s\n", BASELINE_FILE);
+            return;
+        }
+        for (int i = 0; i < result_count; i++) {
+            fprintf(f, "%s %.3f\n", results[i].name, results[i].ms);
+        }
+        fclose(f);
+        printf("\nBaseline saved to %s\n", BASELINE_FILE);
+        return;
+    }
+
+    FILE* f = fopen(BASELINE_FILE, "r");
+    if (!f) {
+        printf("\nNo baseline at %s (run with --save-baseline to create one)\n",
+            BASELINE_FILE);
+        return;
+    }
+    printf("\nBaseline comparison (%s):\n", BASELINE_FILE);
+    char name[128];
+    double base_ms;
+    while (fscanf(f, "%127s %lf", name, &base_ms) == 2) {
+        for (int i = 0; i < result_count; i++) {
+            if (strcmp(results[i].name, name) == 0) {
+                double delta = base_ms > 0.0
+                    ? (results[i].ms - base_ms) / base_ms * 100.0 : 0.0;
+                printf("  %-32s %10.3f ms  (baseline %.3f ms, %+.1f%%)\n",
+                    name, results[i].ms, base_ms, delta);
+                break;
+            }
+        }
+    }
+    fclose(f);
+}
+
+int main(int argc, char** argv) {
+    bool save_baseline = argc > 1 && strcmp(argv[1], "--save-baseline") == 0;
+
+    mkdir(BENCH_DIR, 0755);
+
+    size_t len;
+    char* src;
+
+    src = gen_functions(2000, &len);
+    run_scenario("functions_2000", src, len);
+
+    src = gen_classes(500, &len);
+    run_scenario("classes_500", src, len);
+
+    src = gen_deep_expr(200, &len);
+    run_scenario("deep_expr_200", src, len);
+
+    src = gen_module_scenario(50, &len);
+    run_scenario("modules_50", src, len);
+
+    compare_baseline(save_baseline);
+    return 0;
+}
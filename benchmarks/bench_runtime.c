@@ -0,0 +1,236 @@
+#include "tick_runtime.h"
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BASELINE_FILE "benchmarks/runtime_baseline.txt"
+
+typedef struct {
+    char name[128];
+    double ns_per_op;
+} BenchResult;
+
+static BenchResult results[64];
+static int result_count = 0;
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static void record(const char* name, double total_ns, long ops) {
+    double ns_per_op = total_ns / (double)ops;
+    double mops = 1000.0 / ns_per_op;
+    BenchResult* r = &results[result_count++];
+    snprintf(r->name, sizeof(r->name), "%s", name);
+    r->ns_per_op = ns_per_op;
+    printf("  %-32s %10.1f ns/op  %8.2f Mops/s\n", name, ns_per_op, mops);
+}
+
+static void bench_signal_spsc(void) {
+    enum { OPS = 1000000 };
+    TickSignal sig;
+    tick_signal_init(&sig);
+    double t0 = now_ns();
+    for (long i = 0; i < OPS; i++) {
+        tick_signal_emit(&sig, (void*)(intptr_t)i);
+        tick_signal_recv(&sig);
+    }
+    record("signal_emit_recv_spsc", now_ns() - t0, OPS);
+    tick_signal_destroy(&sig);
+}
+
+typedef struct {
+    TickSignal* sig;
+    long ops;
+} SignalThreadArg;
+
+static void* signal_producer(void* arg) {
+    SignalThreadArg* a = (SignalThreadArg*)arg;
+    for (long i = 0; i < a->ops; i++) {
+        tick_signal_emit(a->sig, (void*)(intptr_t)i);
+    }
+    return NULL;
+}
+
+static void* signal_consumer(void* arg) {
+    SignalThreadArg* a = (SignalThreadArg*)arg;
+    for (long i = 0; i < a->ops; i++) {
+        tick_signal_recv(a->sig);
+    }
+    return NULL;
+}
+
+static void bench_signal_mpmc(int producers, int consumers) {
+    enum { TOTAL_OPS = 1000000 };
+    TickSignal sig;
+    tick_signal_init(&sig);
+    pthread_t threads[16];
+    SignalThreadArg prod_arg = { &sig, TOTAL_OPS / producers };
+    SignalThreadArg cons_arg = { &sig, TOTAL_OPS / consumers };
+
+    double t0 = now_ns();
+    for (int i = 0; i < producers; i++) {
+        pthread_create(&threads[i], NULL, signal_producer, &prod_arg);
+    }
+    for (int i = 0; i < consumers; i++) {
+        pthread_create(&threads[producers + i], NULL, signal_consumer, &cons_arg);
+    }
+    for (int i = 0; i < producers + consumers; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    char name[64];
+    snprintf(name, sizeof(name), "signal_mpmc_%dp_%dc", producers, consumers);
+    record(name, now_ns() - t0, TOTAL_OPS);
+    tick_signal_destroy(&sig);
+}
+
+static void bench_signal_batch(void) {
+    enum { OPS = 1000000, BATCH = 64 };
+    TickSignal sig;
+    tick_signal_init(&sig);
+    void* batch[BATCH];
+    for (int i = 0; i < BATCH; i++) batch[i] = (void*)(intptr_t)i;
+    double t0 = now_ns();
+    for (long i = 0; i < OPS / BATCH; i++) {
+        tick_signal_emit_n(&sig, batch, BATCH);
+        tick_signal_recv_n(&sig, batch, BATCH);
+    }
+    record("signal_emit_recv_batch64", now_ns() - t0, OPS);
+    tick_signal_destroy(&sig);
+}
+
+static void* bench_process(void* arg) {
+    (void)arg;
+    return NULL;
+}
+
+static void bench_event_fanout(int processes) {
+    enum { ROUNDS = 10000 };
+    TickEvent evt;
+    tick_event_init(&evt, processes);
+    for (int i = 0; i < processes; i++) {
+        tick_event_add_process(&evt, bench_process);
+    }
+    double t0 = now_ns();
+    for (long i = 0; i < ROUNDS; i++) {
+        tick_event_execute(&evt);
+        tick_event_wait(&evt);
+    }
+    char name[64];
+    snprintf(name, sizeof(name), "event_fanout_%d", processes);
+    record(name, now_ns() - t0, (long)ROUNDS * processes);
+    tick_event_destroy(&evt);
+}
+
+static void bench_str_concat(void) {
+    enum { OPS = 1000000 };
+    double t0 = now_ns();
+    for (long i = 0; i < OPS; i++) {
+        tick_str_concat("hello, ", "world");
+    }
+    record("str_concat_short", now_ns() - t0, OPS);
+
+    const char* parts[8] = { "alpha", "beta", "gamma", "delta",
+                             "epsilon", "zeta", "eta", "theta" };
+    t0 = now_ns();
+    for (long i = 0; i < OPS; i++) {
+        tick_str_concat_n(parts, 8);
+    }
+    record("str_concat_n8", now_ns() - t0, OPS);
+}
+
+static void bench_array_push(void) {
+    enum { ROUNDS = 1000, N = 10000 };
+    double t0 = now_ns();
+    for (long r = 0; r < ROUNDS; r++) {
+        TickArray arr;
+        memset(&arr, 0, sizeof(arr));
+        for (long i = 0; i < N; i++) {
+            tick_array_push(&arr, sizeof(int64_t));
+            ((int64_t*)arr.ptr)[arr.len - 1] = i;
+        }
+        free(arr.ptr);
+    }
+    record("array_push_i64", now_ns() - t0, (long)ROUNDS * N);
+
+    t0 = now_ns();
+    for (long r = 0; r < ROUNDS; r++) {
+        TickArray arr;
+        memset(&arr, 0, sizeof(arr));
+        tick_array_reserve(&arr, sizeof(int64_t), N);
+        for (long i = 0; i < N; i++) {
+            tick_array_push(&arr, sizeof(int64_t));
+            ((int64_t*)arr.ptr)[arr.len - 1] = i;
+        }
+        free(arr.ptr);
+    }
+    record("array_push_i64_reserved", now_ns() - t0, (long)ROUNDS * N);
+}
+
+static void compare_baseline(int save) {
+    if (save) {
+        FILE* f = fopen(BASELINE_FILE, "w");
+        if (!f) {
+            fprintf(stderr, "Cannot write %s\n", BASELINE_FILE);
+            return;
+        }
+        for (int i = 0; i < result_count; i++) {
+            fprintf(f, "%s %.1f\n", results[i].name, results[i].ns_per_op);
+        }
+        fclose(f);
+        printf("\nBaseline saved to %s\n", BASELINE_FILE);
+        return;
+    }
+
+    FILE* f = fopen(BASELINE_FILE, "r");
+    if (!f) {
+        printf("\nNo baseline at %s (run with --save-baseline to create one)\n",
+            BASELINE_FILE);
+        return;
+    }
+    printf("\nBaseline comparison (%s):\n", BASELINE_FILE);
+    char name[128];
+    double base_ns;
+    while (fscanf(f, "%127s %lf", name, &base_ns) == 2) {
+        for (int i = 0; i < result_count; i++) {
+            if (strcmp(results[i].name, name) == 0) {
+                double delta = base_ns > 0.0
+                    ? (results[i].ns_per_op - base_ns) / base_ns * 100.0 : 0.0;
+                printf("  %-32s %10.1f ns/op  (baseline %.1f, %+.1f%%)\n",
+                    name, results[i].ns_per_op, base_ns, delta);
+                break;
+            }
+        }
+    }
+    fclose(f);
+}
+
+int main(int argc, char** argv) {
+    int save_baseline = argc > 1 && strcmp(argv[1], "--save-baseline") == 0;
+
+    printf("signals\n");
+    bench_signal_spsc();
+    bench_signal_mpmc(1, 1);
+    bench_signal_mpmc(4, 4);
+    bench_signal_batch();
+
+    printf("events\n");
+    bench_event_fanout(1);
+    bench_event_fanout(4);
+    bench_event_fanout(16);
+    bench_event_fanout(64);
+
+    printf("strings\n");
+    bench_str_concat();
+
+    printf("arrays\n");
+    bench_array_push();
+
+    compare_baseline(save_baseline);
+    return 0;
+}
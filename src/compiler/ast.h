@@ -3,6 +3,7 @@
 
 #include "../core/string.h"
 #include "../core/dynamic_array.h"
+#include "../core/arena.h"
 
 namespace Tick {
 
@@ -19,7 +20,7 @@ enum class AstNodeType {
     INTERFACE_DECL,
     EXTERN_FUNC_DECL,
     VAR_DECL,
-    
+
     BLOCK_STMT,
     EXPR_STMT,
     IF_STMT,
@@ -32,7 +33,7 @@ enum class AstNodeType {
     SWITCH_STMT,
     TRY_CATCH_STMT,
     THROW_STMT,
-    
+
     BINARY_EXPR,
     UNARY_EXPR,
     ASSIGN_EXPR,
@@ -58,12 +59,13 @@ enum class AstNodeType {
 struct AstNode {
     AstNodeType type;
     int line;
-    
+
     AstNode(AstNodeType t) : type(t), line(0) {}
-    virtual ~AstNode() {}
 };
 
 struct ExprNode : public AstNode {
+    String resolved_type;
+
     ExprNode(AstNodeType t) : AstNode(t) {}
 };
 
@@ -73,43 +75,43 @@ struct StmtNode : public AstNode {
 
 struct IntegerLiteral : public ExprNode {
     int value;
-    
-    IntegerLiteral(int val) 
+
+    IntegerLiteral(int val)
         : ExprNode(AstNodeType::INTEGER_LITERAL), value(val) {}
 };
 
 struct FloatLiteral : public ExprNode {
     float value;
-    
-    FloatLiteral(float val) 
+
+    FloatLiteral(float val)
         : ExprNode(AstNodeType::FLOAT_LITERAL), value(val) {}
 };
 
 struct DoubleLiteral : public ExprNode {
     double value;
-    
-    DoubleLiteral(double val) 
+
+    DoubleLiteral(double val)
         : ExprNode(AstNodeType::DOUBLE_LITERAL), value(val) {}
 };
 
 struct BoolLiteral : public ExprNode {
     bool value;
-    
-    BoolLiteral(bool val) 
+
+    BoolLiteral(bool val)
         : ExprNode(AstNodeType::BOOL_LITERAL), value(val) {}
 };
 
 struct StringLiteral : public ExprNode {
     String value;
-    
-    StringLiteral(const String& val) 
+
+    StringLiteral(const String& val)
         : ExprNode(AstNodeType::STRING_LITERAL), value(val) {}
 };
 
 struct IdentifierExpr : public ExprNode {
     String name;
-    
-    IdentifierExpr(const String& n) 
+
+    IdentifierExpr(const String& n)
         : ExprNode(AstNodeType::IDENTIFIER_EXPR), name(n) {}
 };
 
@@ -117,119 +119,72 @@ struct BinaryExpr : public ExprNode {
     ExprNode* left;
     String op;
     ExprNode* right;
-    
+
     BinaryExpr(ExprNode* l, const String& o, ExprNode* r)
         : ExprNode(AstNodeType::BINARY_EXPR), left(l), op(o), right(r) {}
-    
-    ~BinaryExpr() {
-        delete left;
-        delete right;
-    }
 };
 
 struct UnaryExpr : public ExprNode {
     String op;
     ExprNode* operand;
-    
+
     UnaryExpr(const String& o, ExprNode* opnd)
         : ExprNode(AstNodeType::UNARY_EXPR), op(o), operand(opnd) {}
-    
-    ~UnaryExpr() {
-        delete operand;
-    }
 };
 
 struct AssignExpr : public ExprNode {
     ExprNode* target;
     ExprNode* value;
-    
+
     AssignExpr(ExprNode* t, ExprNode* v)
         : ExprNode(AstNodeType::ASSIGN_EXPR), target(t), value(v) {}
-    
-    ~AssignExpr() {
-        delete target;
-        delete value;
-    }
 };
 
 struct CompoundAssignExpr : public ExprNode {
     ExprNode* target;
     String op;
     ExprNode* value;
-    
+
     CompoundAssignExpr(ExprNode* t, const String& o, ExprNode* v)
         : ExprNode(AstNodeType::COMPOUND_ASSIGN_EXPR), target(t), op(o), value(v) {}
-    
-    ~CompoundAssignExpr() {
-        delete target;
-        delete value;
-    }
 };
 
 struct CallExpr : public ExprNode {
     ExprNode* callee;
     DynamicArray<ExprNode*> arguments;
-    
-    CallExpr(ExprNode* c) 
+
+    CallExpr(ExprNode* c)
         : ExprNode(AstNodeType::CALL_EXPR), callee(c) {}
-    
-    ~CallExpr() {
-        delete callee;
-        for (size_t i = 0; i < arguments.size(); i++) {
-            delete arguments[i];
-        }
-    }
 };
 
 struct MemberExpr : public ExprNode {
     ExprNode* object;
     String member;
-    
+
     MemberExpr(ExprNode* obj, const String& mem)
         : ExprNode(AstNodeType::MEMBER_EXPR), object(obj), member(mem) {}
-    
-    ~MemberExpr() {
-        delete object;
-    }
 };
 
 struct IndexExpr : public ExprNode {
     ExprNode* array;
     ExprNode* index;
-    
+
     IndexExpr(ExprNode* arr, ExprNode* idx)
         : ExprNode(AstNodeType::INDEX_EXPR), array(arr), index(idx) {}
-    
-    ~IndexExpr() {
-        delete array;
-        delete index;
-    }
 };
 
 struct ArrayExpr : public ExprNode {
     DynamicArray<ExprNode*> elements;
-    
+
     ArrayExpr() : ExprNode(AstNodeType::ARRAY_EXPR) {}
-    
-    ~ArrayExpr() {
-        for (size_t i = 0; i < elements.size(); i++) {
-            delete elements[i];
-        }
-    }
 };
 
 struct NewExpr : public ExprNode {
     String class_name;
     DynamicArray<ExprNode*> arguments;
-    
-    NewExpr(const String& name) 
+
+    NewExpr(const String& name)
         : ExprNode(AstNodeType::NEW_EXPR), class_name(name) {}
-    
-    ~NewExpr() {
-        for (size_t i = 0; i < arguments.size(); i++) {
-            delete arguments[i];
-        }
-    }
 };
 
 struct ThisExpr : public ExprNode {
@@ -238,25 +193,15 @@ struct ThisExpr : public ExprNode {
 
 struct BlockStmt : public StmtNode {
     DynamicArray<StmtNode*> statements;
-    
+
     BlockStmt() : StmtNode(AstNodeType::BLOCK_STMT) {}
-    
-    ~BlockStmt() {
-        for (size_t i = 0; i < statements.size(); i++) {
-            delete statements[i];
-        }
-    }
 };
 
 struct ExprStmt : public StmtNode {
     ExprNode* expression;
-    
-    ExprStmt(ExprNode* expr) 
+
+    ExprStmt(ExprNode* expr)
         : StmtNode(AstNodeType::EXPR_STMT), expression(expr) {}
-    
-    ~ExprStmt() {
-        delete expression;
-    }
 };
 
 struct VarDecl : public StmtNode {
@@ -264,52 +209,33 @@ struct VarDecl : public StmtNode {
     String name;
     ExprNode* initializer;
     bool is_const;
-    
+
     VarDecl(const String& type, const String& n, ExprNode* init, bool const_flag = false)
         : StmtNode(AstNodeType::VAR_DECL), type_name(type), name(n), initializer(init), is_const(const_flag) {}
-    
-    ~VarDecl() {
-        if (initializer) delete initializer;
-    }
 };
 
 struct IfStmt : public StmtNode {
     ExprNode* condition;
     StmtNode* then_branch;
     StmtNode* else_branch;
-    
+
     IfStmt(ExprNode* cond, StmtNode* then_br, StmtNode* else_br)
         : StmtNode(AstNodeType::IF_STMT), condition(cond), then_branch(then_br), else_branch(else_br) {}
-    
-    ~IfStmt() {
-        delete condition;
-        delete then_branch;
-        if (else_branch) delete else_branch;
-    }
 };
 
 struct WhileStmt : public StmtNode {
     ExprNode* condition;
     StmtNode* body;
-    
+
     WhileStmt(ExprNode* cond, StmtNode* b)
         : StmtNode(AstNodeType::WHILE_STMT), condition(cond), body(b) {}
-    
-    ~WhileStmt() {
-        delete condition;
-        delete body;
-    }
 };
 
 struct ReturnStmt : public StmtNode {
     ExprNode* value;
-    
+
     ReturnStmt(ExprNode* val)
         : StmtNode(AstNodeType::RETURN_STMT), value(val) {}
-    
-    ~ReturnStmt() {
-        if (value) delete value;
-    }
 };
 
 struct BreakStmt : public StmtNode {
@@ -322,50 +248,33 @@ struct ContinueStmt : public StmtNode {
 
 struct DeferStmt : public StmtNode {
     StmtNode* statement;
-    
+
     DeferStmt(StmtNode* stmt)
         : StmtNode(AstNodeType::DEFER_STMT), statement(stmt) {}
-    
-    ~DeferStmt() {
-        delete statement;
-    }
 };
 
 struct SwitchCase {
     DynamicArray<ExprNode*> values;
     BlockStmt* body;
     bool is_default;
-    
+
     SwitchCase() : body(nullptr), is_default(false) {}
-    ~SwitchCase() {
-        for (size_t i = 0; i < values.size(); i++) delete values[i];
-        if (body) delete body;
-    }
 };
 
 struct SwitchStmt : public StmtNode {
     ExprNode* subject;
     DynamicArray<SwitchCase*> cases;
-    
+
     SwitchStmt(ExprNode* subj)
         : StmtNode(AstNodeType::SWITCH_STMT), subject(subj) {}
-    
-    ~SwitchStmt() {
-        delete subject;
-        for (size_t i = 0; i < cases.size(); i++) delete cases[i];
-    }
 };
 
 struct PostfixExpr : public ExprNode {
     ExprNode* operand;
     String op;
-    
+
     PostfixExpr(ExprNode* opnd, const String& o)
         : ExprNode(AstNodeType::POSTFIX_EXPR), operand(opnd), op(o) {}
-    
-    ~PostfixExpr() {
-        delete operand;
-    }
 };
 
 struct ForStmt : public StmtNode {
@@ -373,30 +282,23 @@ struct ForStmt : public StmtNode {
     ExprNode* condition;
     ExprNode* increment;
     StmtNode* body;
-    
+
     ForStmt(StmtNode* init, ExprNode* cond, ExprNode* incr, StmtNode* b)
         : StmtNode(AstNodeType::FOR_STMT), initializer(init), condition(cond), increment(incr), body(b) {}
-    
-    ~ForStmt() {
-        if (initializer) delete initializer;
-        if (condition) delete condition;
-        if (increment) delete increment;
-        delete body;
-    }
 };
 
 struct ImportDecl : public AstNode {
     String module_path;
     DynamicArray<String> imported_names;
     bool import_all;
-    
-    ImportDecl(const String& path) 
+
+    ImportDecl(const String& path)
         : AstNode(AstNodeType::IMPORT_DECL), module_path(path), import_all(true) {}
 };
 
 struct EventDecl : public AstNode {
     String name;
-    
+
     EventDecl(const String& n)
         : AstNode(AstNodeType::EVENT_DECL), name(n) {}
 };
@@ -405,7 +307,7 @@ struct SignalDecl : public AstNode {
     String type_param;
     String name;
     int array_size;
-    
+
     SignalDecl(const String& type, const String& n, int size = 0)
         : AstNode(AstNodeType::SIGNAL_DECL), type_param(type), name(n), array_size(size) {}
 };
@@ -414,19 +316,15 @@ struct ProcessDecl : public AstNode {
     String event_name;
     String name;
     BlockStmt* body;
-    
+
     ProcessDecl(const String& evt, const String& n, BlockStmt* b)
         : AstNode(AstNodeType::PROCESS_DECL), event_name(evt), name(n), body(b) {}
-    
-    ~ProcessDecl() {
-        delete body;
-    }
 };
 
 struct Parameter {
     String type_name;
     String name;
-    
+
     Parameter(const String& type, const String& n)
         : type_name(type), name(n) {}
 };
@@ -438,16 +336,9 @@ struct FunctionDecl : public AstNode {
     bool is_destructor;
     DynamicArray<Parameter*> parameters;
     BlockStmt* body;
-    
+
     FunctionDecl(const String& ret_type, const String& n, BlockStmt* b)
         : AstNode(AstNodeType::FUNCTION_DECL), return_type(ret_type), name(n), is_destructor(false), body(b) {}
-    
-    ~FunctionDecl() {
-        for (size_t i = 0; i < parameters.size(); i++) {
-            delete parameters[i];
-        }
-        delete body;
-    }
 };
 
 struct ClassDecl : public AstNode {
@@ -456,22 +347,16 @@ struct ClassDecl : public AstNode {
     DynamicArray<String> interfaces;
     DynamicArray<VarDecl*> fields;
     bool is_dataclass;
-    
+
     ClassDecl(const String& n)
         : AstNode(AstNodeType::CLASS_DECL), name(n), is_dataclass(false) {}
-    
-    ~ClassDecl() {
-        for (size_t i = 0; i < fields.size(); i++) {
-            delete fields[i];
-        }
-    }
 };
 
 struct EnumValue {
     String name;
     int value;
     bool has_value;
-    
+
     EnumValue(const String& n) : name(n), value(0), has_value(false) {}
     EnumValue(const String& n, int v) : name(n), value(v), has_value(true) {}
 };
@@ -479,57 +364,41 @@ struct EnumValue {
 struct EnumDecl : public AstNode {
     String name;
     DynamicArray<EnumValue*> values;
-    
+
     EnumDecl(const String& n)
         : AstNode(AstNodeType::ENUM_DECL), name(n) {}
-    
-    ~EnumDecl() {
-        for (size_t i = 0; i < values.size(); i++) delete values[i];
-    }
 };
 
 struct UnionField {
     String type_name;
     String name;
-    
+
     UnionField(const String& type, const String& n) : type_name(type), name(n) {}
 };
 
 struct UnionDecl : public AstNode {
     String name;
     DynamicArray<UnionField*> fields;
-    
+
     UnionDecl(const String& n)
         : AstNode(AstNodeType::UNION_DECL), name(n) {}
-    
-    ~UnionDecl() {
-        for (size_t i = 0; i < fields.size(); i++) delete fields[i];
-    }
 };
 
 struct InterfaceMethod {
     String name;
     String return_type;
     DynamicArray<Parameter*> parameters;
-    
+
     InterfaceMethod(const String& n, const String& ret)
         : name(n), return_type(ret) {}
-    
-    ~InterfaceMethod() {
-        for (size_t i = 0; i < parameters.size(); i++) delete parameters[i];
-    }
 };
 
 struct InterfaceDecl : public AstNode {
     String name;
     DynamicArray<InterfaceMethod*> methods;
-    
+
     InterfaceDecl(const String& n)
         : AstNode(AstNodeType::INTERFACE_DECL), name(n) {}
-    
-    ~InterfaceDecl() {
-        for (size_t i = 0; i < methods.size(); i++) delete methods[i];
-    }
 };
 
 struct TryCatchStmt : public StmtNode {
@@ -537,47 +406,34 @@ struct TryCatchStmt : public StmtNode {
     String catch_var;
     String catch_type;
     BlockStmt* catch_body;
-    
+
     TryCatchStmt(BlockStmt* tb, const String& cv, const String& ct, BlockStmt* cb)
         : StmtNode(AstNodeType::TRY_CATCH_STMT), try_body(tb),
           catch_var(cv), catch_type(ct), catch_body(cb) {}
-    
-    ~TryCatchStmt() {
-        delete try_body;
-        delete catch_body;
-    }
 };
 
 struct ThrowStmt : public StmtNode {
     ExprNode* value;
-    
+
     ThrowStmt(ExprNode* v)
         : StmtNode(AstNodeType::THROW_STMT), value(v) {}
-    
-    ~ThrowStmt() { delete value; }
 };
 
 struct ExternFuncDecl : public AstNode {
     String return_type;
     String name;
     DynamicArray<Parameter*> parameters;
-    
+
     ExternFuncDecl(const String& ret_type, const String& n)
         : AstNode(AstNodeType::EXTERN_FUNC_DECL), return_type(ret_type), name(n) {}
-    
-    ~ExternFuncDecl() {
-        for (size_t i = 0; i < parameters.size(); i++) delete parameters[i];
-    }
 };
 
 struct CastExpr : public ExprNode {
     ExprNode* expression;
     String target_type;
-    
+
     CastExpr(ExprNode* expr, const String& type)
         : ExprNode(AstNodeType::CAST_EXPR), expression(expr), target_type(type) {}
-    
-    ~CastExpr() { delete expression; }
 };
 
 struct NullLiteral : public ExprNode {
@@ -586,12 +442,13 @@ struct NullLiteral : public ExprNode {
 
 struct SizeofExpr : public ExprNode {
     String target_type;
-    
+
     SizeofExpr(const String& type)
         : ExprNode(AstNodeType::SIZEOF_EXPR), target_type(type) {}
 };
 
 struct Program : public AstNode {
+    Arena arena;
     DynamicArray<ImportDecl*> imports;
     DynamicArray<VarDecl*> globals;
     DynamicArray<EventDecl*> events;
@@ -605,47 +462,8 @@ struct Program : public AstNode {
     DynamicArray<InterfaceDecl*> interfaces;
     DynamicArray<ExternFuncDecl*> extern_functions;
     DynamicArray<String> link_flags;
-    
+
     Program() : AstNode(AstNodeType::PROGRAM) {}
-    
-    ~Program() {
-        for (size_t i = 0; i < imports.size(); i++) {
-            if (imports[i]) delete imports[i];
-        }
-        for (size_t i = 0; i < globals.size(); i++) {
-            if (globals[i]) delete globals[i];
-        }
-        for (size_t i = 0; i < events.size(); i++) {
-            if (events[i]) delete events[i];
-        }
-        for (size_t i = 0; i < signals.size(); i++) {
-            if (signals[i]) delete signals[i];
-        }
-        for (size_t i = 0; i < processes.size(); i++) {
-            if (processes[i]) delete processes[i];
-        }
-        for (size_t i = 0; i < functions.size(); i++) {
-            if (functions[i]) delete functions[i];
-        }
-        for (size_t i = 0; i < methods.size(); i++) {
-            if (methods[i]) delete methods[i];
-        }
-        for (size_t i = 0; i < classes.size(); i++) {
-            if (classes[i]) delete classes[i];
-        }
-        for (size_t i = 0; i < enums.size(); i++) {
-            if (enums[i]) delete enums[i];
-        }
-        for (size_t i = 0; i < unions.size(); i++) {
-            if (unions[i]) delete unions[i];
-        }
-        for (size_t i = 0; i < interfaces.size(); i++) {
-            if (interfaces[i]) delete interfaces[i];
-        }
-        for (size_t i = 0; i < extern_functions.size(); i++) {
-            if (extern_functions[i]) delete extern_functions[i];
-        }
-    }
 };
 
 }
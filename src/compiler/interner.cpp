@@ -0,0 +1,85 @@
+#include "interner.h"
+#include "../core/arena.h"
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <pthread.h>
+
+namespace Tick {
+
+struct InternEntry {
+    const char* str;
+    size_t length;
+    uint32_t hash;
+};
+
+static pthread_mutex_t _lock = PTHREAD_MUTEX_INITIALIZER;
+static InternEntry* _entries = nullptr;
+static size_t _capacity = 0;
+static size_t _count = 0;
+static Arena _storage;
+
+static uint32_t hash_bytes(const char* str, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char)str[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static void grow_table() {
+    size_t new_capacity = (_capacity == 0) ? 1024 : (_capacity * 2);
+    InternEntry* new_entries = (InternEntry*)calloc(new_capacity, sizeof(InternEntry));
+
+    for (size_t i = 0; i < _capacity; i++) {
+        if (!_entries[i].str) continue;
+        size_t index = _entries[i].hash & (new_capacity - 1);
+        while (new_entries[index].str) {
+            index = (index + 1) & (new_capacity - 1);
+        }
+        new_entries[index] = _entries[i];
+    }
+
+    free(_entries);
+    _entries = new_entries;
+    _capacity = new_capacity;
+}
+
+const char* StringInterner::intern(const char* str, size_t length) {
+    pthread_mutex_lock(&_lock);
+    if (_count * 4 >= _capacity * 3) {
+        grow_table();
+    }
+
+    uint32_t hash = hash_bytes(str, length);
+    size_t index = hash & (_capacity - 1);
+
+    while (_entries[index].str) {
+        if (_entries[index].hash == hash && _entries[index].length == length &&
+            memcmp(_entries[index].str, str, length) == 0) {
+            const char* found = _entries[index].str;
+            pthread_mutex_unlock(&_lock);
+            return found;
+        }
+        index = (index + 1) & (_capacity - 1);
+    }
+
+    char* copy = (char*)_storage.alloc(length + 1);
+    memcpy(copy, str, length);
+    copy[length] = '\0';
+
+    _entries[index].str = copy;
+    _entries[index].length = length;
+    _entries[index].hash = hash;
+    _count++;
+
+    pthread_mutex_unlock(&_lock);
+    return copy;
+}
+
+const char* StringInterner::intern(const char* str) {
+    return intern(str, strlen(str));
+}
+
+}
@@ -0,0 +1,16 @@
+#ifndef TICK_INTERNER_H
+#define TICK_INTERNER_H
+
+#include <cstddef>
+
+namespace Tick {
+
+class StringInterner {
+public:
+    static const char* intern(const char* str, size_t length);
+    static const char* intern(const char* str);
+};
+
+}
+
+#endif
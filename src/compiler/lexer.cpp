@@ -1,12 +1,17 @@
 #include "lexer.h"
+#include "interner.h"
 #include <cstdio>
 #include <cstring>
 #include <cctype>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace Tick {
 
-Lexer::Lexer(const char* source) 
-    : _source(source), _position(0), _line(1), _column(1) {}
+Lexer::Lexer(const char* source)
+    : _source(source), _position(0), _length(strlen(source)), _line(1), _column(1) {}
 
 char Lexer::current_char() {
     return _source[_position];
@@ -29,8 +34,32 @@ void Lexer::advance() {
     _position++;
 }
 
+void Lexer::advance_chunk(int newline_mask, int count) {
+    _position += count;
+    if (newline_mask) {
+        _line += __builtin_popcount(newline_mask);
+        int last_newline = 31 - __builtin_clz(newline_mask);
+        _column = count - last_newline;
+    } else {
+        _column += count;
+    }
+}
+
 void Lexer::skip_whitespace() {
-    while (current_char() == ' ' || current_char() == '\t' || 
+#if defined(__SSE2__)
+    while (_position + 16 <= _length) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(_source + _position));
+        __m128i newlines = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n'));
+        __m128i ws = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')),
+                         _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\t'))),
+            _mm_or_si128(newlines,
+                         _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\r'))));
+        if (_mm_movemask_epi8(ws) != 0xFFFF) break;
+        advance_chunk(_mm_movemask_epi8(newlines), 16);
+    }
+#endif
+    while (current_char() == ' ' || current_char() == '\t' ||
            current_char() == '\n' || current_char() == '\r') {
         advance();
     }
@@ -56,12 +85,7 @@ void Lexer::skip_comment() {
 }
 
 Token Lexer::make_token(TokenType type, const char* start, size_t length) {
-    char* lexeme = (char*)malloc(length + 1);
-    memcpy(lexeme, start, length);
-    lexeme[length] = '\0';
-    Token token(type, lexeme, _line, _column - length);
-    free(lexeme);
-    return token;
+    return Token(type, start, (int)length, _line, _column - length);
 }
 
 TokenType Lexer::check_keyword(const char* str, size_t length) {
@@ -132,7 +156,24 @@ TokenType Lexer::check_keyword(const char* str, size_t length) {
 Token Lexer::read_identifier() {
     const char* start = &_source[_position];
     size_t length = 0;
-    
+
+#if defined(__SSE2__)
+    while (_position + 16 <= _length) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(_source + _position));
+        __m128i folded = _mm_or_si128(chunk, _mm_set1_epi8(0x20));
+        __m128i alpha = _mm_and_si128(
+            _mm_cmpgt_epi8(folded, _mm_set1_epi8('a' - 1)),
+            _mm_cmpgt_epi8(_mm_set1_epi8('z' + 1), folded));
+        __m128i digit = _mm_and_si128(
+            _mm_cmpgt_epi8(chunk, _mm_set1_epi8('0' - 1)),
+            _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), chunk));
+        __m128i ident = _mm_or_si128(_mm_or_si128(alpha, digit),
+                                     _mm_cmpeq_epi8(chunk, _mm_set1_epi8('_')));
+        if (_mm_movemask_epi8(ident) != 0xFFFF) break;
+        advance_chunk(0, 16);
+        length += 16;
+    }
+#endif
     while ((current_char() >= 'a' && current_char() <= 'z') ||
            (current_char() >= 'A' && current_char() <= 'Z') ||
            (current_char() >= '0' && current_char() <= '9') ||
@@ -142,14 +183,25 @@ Token Lexer::read_identifier() {
     }
     
     TokenType type = check_keyword(start, length);
-    return make_token(type, start, length);
+    return make_token(type, StringInterner::intern(start, length), length);
 }
 
 Token Lexer::read_number() {
     const char* start = &_source[_position];
     size_t length = 0;
     bool is_float = false;
-    
+
+#if defined(__SSE2__)
+    while (_position + 16 <= _length) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(_source + _position));
+        __m128i digit = _mm_and_si128(
+            _mm_cmpgt_epi8(chunk, _mm_set1_epi8('0' - 1)),
+            _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), chunk));
+        if (_mm_movemask_epi8(digit) != 0xFFFF) break;
+        advance_chunk(0, 16);
+        length += 16;
+    }
+#endif
     while (current_char() >= '0' && current_char() <= '9') {
         advance();
         length++;
@@ -182,7 +234,18 @@ Token Lexer::read_string() {
     advance();
     const char* start = &_source[_position];
     size_t length = 0;
-    
+
+#if defined(__SSE2__)
+    while (_position + 16 <= _length) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(_source + _position));
+        __m128i stop = _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('"')),
+                                    _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\')));
+        if (_mm_movemask_epi8(stop) != 0) break;
+        __m128i newlines = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n'));
+        advance_chunk(_mm_movemask_epi8(newlines), 16);
+        length += 16;
+    }
+#endif
     while (current_char() != '"' && current_char() != '\0') {
         if (current_char() == '\\') {
             advance();
@@ -207,7 +270,16 @@ Token Lexer::read_multiline_string() {
     advance();
     const char* start = &_source[_position];
     size_t length = 0;
-    
+
+#if defined(__SSE2__)
+    while (_position + 16 <= _length) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(_source + _position));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('`'))) != 0) break;
+        __m128i newlines = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n'));
+        advance_chunk(_mm_movemask_epi8(newlines), 16);
+        length += 16;
+    }
+#endif
     while (current_char() != '`' && current_char() != '\0') {
         advance();
         length++;
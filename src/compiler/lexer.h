@@ -15,12 +15,14 @@ public:
 private:
     const char* _source;
     size_t _position;
+    size_t _length;
     size_t _line;
     size_t _column;
-    
+
     char current_char();
     char peek_char(int offset = 1);
     void advance();
+    void advance_chunk(int newline_mask, int count);
     void skip_whitespace();
     void skip_comment();
     
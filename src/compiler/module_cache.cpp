@@ -0,0 +1,927 @@
+#include "module_cache.h"
+#include "source_file.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Tick {
+
+static const uint32_t CACHE_MAGIC = 0x444f4d54;
+static const uint32_t CACHE_VERSION = 1;
+static const uint8_t NULL_TAG = 0xFF;
+
+struct CacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t source_size;
+    uint64_t source_mtime;
+    uint64_t source_hash;
+};
+
+static uint64_t hash_source(const char* data, size_t size) {
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= (unsigned char)data[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+static void cache_path_for(const char* source_path, char* buf, size_t buf_size) {
+    snprintf(buf, buf_size, "%s.tickmod", source_path);
+}
+
+struct CacheWriter {
+    char* data;
+    size_t size;
+    size_t cap;
+
+    CacheWriter() : size(0), cap(16384) {
+        data = (char*)malloc(cap);
+    }
+
+    ~CacheWriter() {
+        free(data);
+    }
+
+    void write_bytes(const void* src, size_t count) {
+        if (size + count > cap) {
+            while (size + count > cap) cap *= 2;
+            data = (char*)realloc(data, cap);
+        }
+        memcpy(data + size, src, count);
+        size += count;
+    }
+
+    void write_u8(uint8_t v) { write_bytes(&v, 1); }
+    void write_i32(int32_t v) { write_bytes(&v, 4); }
+    void write_u32(uint32_t v) { write_bytes(&v, 4); }
+    void write_f32(float v) { write_bytes(&v, 4); }
+    void write_f64(double v) { write_bytes(&v, 8); }
+
+    void write_string(const String& s) {
+        write_u32((uint32_t)s.length());
+        write_bytes(s.c_str(), s.length());
+    }
+};
+
+struct CacheReader {
+    const char* data;
+    size_t pos;
+
+    CacheReader(const char* d, size_t offset) : data(d), pos(offset) {}
+
+    void read_bytes(void* dst, size_t count) {
+        memcpy(dst, data + pos, count);
+        pos += count;
+    }
+
+    uint8_t read_u8() { uint8_t v; read_bytes(&v, 1); return v; }
+    int32_t read_i32() { int32_t v; read_bytes(&v, 4); return v; }
+    uint32_t read_u32() { uint32_t v; read_bytes(&v, 4); return v; }
+    float read_f32() { float v; read_bytes(&v, 4); return v; }
+    double read_f64() { double v; read_bytes(&v, 8); return v; }
+
+    String read_string() {
+        uint32_t len = read_u32();
+        String s(data + pos, len);
+        pos += len;
+        return s;
+    }
+};
+
+static void write_expr(CacheWriter& w, ExprNode* e);
+static ExprNode* read_expr(CacheReader& r, Arena& arena);
+static void write_stmt(CacheWriter& w, StmtNode* s);
+static StmtNode* read_stmt(CacheReader& r, Arena& arena);
+
+static void write_block(CacheWriter& w, BlockStmt* block) {
+    write_stmt(w, block);
+}
+
+static BlockStmt* read_block(CacheReader& r, Arena& arena) {
+    return static_cast<BlockStmt*>(read_stmt(r, arena));
+}
+
+static void write_expr(CacheWriter& w, ExprNode* e) {
+    if (!e) {
+        w.write_u8(NULL_TAG);
+        return;
+    }
+    w.write_u8((uint8_t)e->type);
+    w.write_i32(e->line);
+
+    switch (e->type) {
+        case AstNodeType::INTEGER_LITERAL:
+            w.write_i32(static_cast<IntegerLiteral*>(e)->value);
+            break;
+        case AstNodeType::FLOAT_LITERAL:
+            w.write_f32(static_cast<FloatLiteral*>(e)->value);
+            break;
+        case AstNodeType::DOUBLE_LITERAL:
+            w.write_f64(static_cast<DoubleLiteral*>(e)->value);
+            break;
+        case AstNodeType::BOOL_LITERAL:
+            w.write_u8(static_cast<BoolLiteral*>(e)->value ? 1 : 0);
+            break;
+        case AstNodeType::STRING_LITERAL:
+            w.write_string(static_cast<StringLiteral*>(e)->value);
+            break;
+        case AstNodeType::NULL_LITERAL:
+        case AstNodeType::THIS_EXPR:
+            break;
+        case AstNodeType::IDENTIFIER_EXPR:
+            w.write_string(static_cast<IdentifierExpr*>(e)->name);
+            break;
+        case AstNodeType::BINARY_EXPR: {
+            BinaryExpr* bin = static_cast<BinaryExpr*>(e);
+            write_expr(w, bin->left);
+            w.write_string(bin->op);
+            write_expr(w, bin->right);
+            break;
+        }
+        case AstNodeType::UNARY_EXPR: {
+            UnaryExpr* un = static_cast<UnaryExpr*>(e);
+            w.write_string(un->op);
+            write_expr(w, un->operand);
+            break;
+        }
+        case AstNodeType::ASSIGN_EXPR: {
+            AssignExpr* assign = static_cast<AssignExpr*>(e);
+            write_expr(w, assign->target);
+            write_expr(w, assign->value);
+            break;
+        }
+        case AstNodeType::COMPOUND_ASSIGN_EXPR: {
+            CompoundAssignExpr* ca = static_cast<CompoundAssignExpr*>(e);
+            write_expr(w, ca->target);
+            w.write_string(ca->op);
+            write_expr(w, ca->value);
+            break;
+        }
+        case AstNodeType::POSTFIX_EXPR: {
+            PostfixExpr* post = static_cast<PostfixExpr*>(e);
+            write_expr(w, post->operand);
+            w.write_string(post->op);
+            break;
+        }
+        case AstNodeType::CALL_EXPR: {
+            CallExpr* call = static_cast<CallExpr*>(e);
+            write_expr(w, call->callee);
+            w.write_u32((uint32_t)call->arguments.size());
+            for (size_t i = 0; i < call->arguments.size(); i++) {
+                write_expr(w, call->arguments[i]);
+            }
+            break;
+        }
+        case AstNodeType::MEMBER_EXPR: {
+            MemberExpr* me = static_cast<MemberExpr*>(e);
+            write_expr(w, me->object);
+            w.write_string(me->member);
+            break;
+        }
+        case AstNodeType::INDEX_EXPR: {
+            IndexExpr* idx = static_cast<IndexExpr*>(e);
+            write_expr(w, idx->array);
+            write_expr(w, idx->index);
+            break;
+        }
+        case AstNodeType::ARRAY_EXPR: {
+            ArrayExpr* arr = static_cast<ArrayExpr*>(e);
+            w.write_u32((uint32_t)arr->elements.size());
+            for (size_t i = 0; i < arr->elements.size(); i++) {
+                write_expr(w, arr->elements[i]);
+            }
+            break;
+        }
+        case AstNodeType::NEW_EXPR: {
+            NewExpr* ne = static_cast<NewExpr*>(e);
+            w.write_string(ne->class_name);
+            w.write_u32((uint32_t)ne->arguments.size());
+            for (size_t i = 0; i < ne->arguments.size(); i++) {
+                write_expr(w, ne->arguments[i]);
+            }
+            break;
+        }
+        case AstNodeType::CAST_EXPR: {
+            CastExpr* ce = static_cast<CastExpr*>(e);
+            write_expr(w, ce->expression);
+            w.write_string(ce->target_type);
+            break;
+        }
+        case AstNodeType::SIZEOF_EXPR:
+            w.write_string(static_cast<SizeofExpr*>(e)->target_type);
+            break;
+        default:
+            break;
+    }
+}
+
+static ExprNode* read_expr(CacheReader& r, Arena& arena) {
+    uint8_t tag = r.read_u8();
+    if (tag == NULL_TAG) return nullptr;
+    AstNodeType type = (AstNodeType)tag;
+    int line = r.read_i32();
+    ExprNode* node = nullptr;
+
+    switch (type) {
+        case AstNodeType::INTEGER_LITERAL:
+            node = arena.make<IntegerLiteral>(r.read_i32());
+            break;
+        case AstNodeType::FLOAT_LITERAL:
+            node = arena.make<FloatLiteral>(r.read_f32());
+            break;
+        case AstNodeType::DOUBLE_LITERAL:
+            node = arena.make<DoubleLiteral>(r.read_f64());
+            break;
+        case AstNodeType::BOOL_LITERAL:
+            node = arena.make<BoolLiteral>(r.read_u8() != 0);
+            break;
+        case AstNodeType::STRING_LITERAL:
+            node = arena.make<StringLiteral>(r.read_string());
+            break;
+        case AstNodeType::NULL_LITERAL:
+            node = arena.make<NullLiteral>();
+            break;
+        case AstNodeType::THIS_EXPR:
+            node = arena.make<ThisExpr>();
+            break;
+        case AstNodeType::IDENTIFIER_EXPR:
+            node = arena.make<IdentifierExpr>(r.read_string());
+            break;
+        case AstNodeType::BINARY_EXPR: {
+            ExprNode* left = read_expr(r, arena);
+            String op = r.read_string();
+            ExprNode* right = read_expr(r, arena);
+            node = arena.make<BinaryExpr>(left, op, right);
+            break;
+        }
+        case AstNodeType::UNARY_EXPR: {
+            String op = r.read_string();
+            ExprNode* operand = read_expr(r, arena);
+            node = arena.make<UnaryExpr>(op, operand);
+            break;
+        }
+        case AstNodeType::ASSIGN_EXPR: {
+            ExprNode* target = read_expr(r, arena);
+            ExprNode* value = read_expr(r, arena);
+            node = arena.make<AssignExpr>(target, value);
+            break;
+        }
+        case AstNodeType::COMPOUND_ASSIGN_EXPR: {
+            ExprNode* target = read_expr(r, arena);
+            String op = r.read_string();
+            ExprNode* value = read_expr(r, arena);
+            node = arena.make<CompoundAssignExpr>(target, op, value);
+            break;
+        }
+        case AstNodeType::POSTFIX_EXPR: {
+            ExprNode* operand = read_expr(r, arena);
+            String op = r.read_string();
+            node = arena.make<PostfixExpr>(operand, op);
+            break;
+        }
+        case AstNodeType::CALL_EXPR: {
+            ExprNode* callee = read_expr(r, arena);
+            CallExpr* call = arena.make<CallExpr>(callee);
+            uint32_t count = r.read_u32();
+            for (uint32_t i = 0; i < count; i++) {
+                call->arguments.push(read_expr(r, arena));
+            }
+            node = call;
+            break;
+        }
+        case AstNodeType::MEMBER_EXPR: {
+            ExprNode* object = read_expr(r, arena);
+            String member = r.read_string();
+            node = arena.make<MemberExpr>(object, member);
+            break;
+        }
+        case AstNodeType::INDEX_EXPR: {
+            ExprNode* array = read_expr(r, arena);
+            ExprNode* index = read_expr(r, arena);
+            node = arena.make<IndexExpr>(array, index);
+            break;
+        }
+        case AstNodeType::ARRAY_EXPR: {
+            ArrayExpr* arr = arena.make<ArrayExpr>();
+            uint32_t count = r.read_u32();
+            for (uint32_t i = 0; i < count; i++) {
+                arr->elements.push(read_expr(r, arena));
+            }
+            node = arr;
+            break;
+        }
+        case AstNodeType::NEW_EXPR: {
+            NewExpr* ne = arena.make<NewExpr>(r.read_string());
+            uint32_t count = r.read_u32();
+            for (uint32_t i = 0; i < count; i++) {
+                ne->arguments.push(read_expr(r, arena));
+            }
+            node = ne;
+            break;
+        }
+        case AstNodeType::CAST_EXPR: {
+            ExprNode* expr = read_expr(r, arena);
+            String target = r.read_string();
+            node = arena.make<CastExpr>(expr, target);
+            break;
+        }
+        case AstNodeType::SIZEOF_EXPR:
+            node = arena.make<SizeofExpr>(r.read_string());
+            break;
+        default:
+            return nullptr;
+    }
+
+    node->line = line;
+    return node;
+}
+
+static void write_stmt(CacheWriter& w, StmtNode* s) {
+    if (!s) {
+        w.write_u8(NULL_TAG);
+        return;
+    }
+    w.write_u8((uint8_t)s->type);
+    w.write_i32(s->line);
+
+    switch (s->type) {
+        case AstNodeType::BLOCK_STMT: {
+            BlockStmt* block = static_cast<BlockStmt*>(s);
+            w.write_u32((uint32_t)block->statements.size());
+            for (size_t i = 0; i < block->statements.size(); i++) {
+                write_stmt(w, block->statements[i]);
+            }
+            break;
+        }
+        case AstNodeType::EXPR_STMT:
+            write_expr(w, static_cast<ExprStmt*>(s)->expression);
+            break;
+        case AstNodeType::VAR_DECL: {
+            VarDecl* var = static_cast<VarDecl*>(s);
+            w.write_string(var->type_name);
+            w.write_string(var->name);
+            write_expr(w, var->initializer);
+            w.write_u8(var->is_const ? 1 : 0);
+            break;
+        }
+        case AstNodeType::IF_STMT: {
+            IfStmt* ifs = static_cast<IfStmt*>(s);
+            write_expr(w, ifs->condition);
+            write_stmt(w, ifs->then_branch);
+            write_stmt(w, ifs->else_branch);
+            break;
+        }
+        case AstNodeType::WHILE_STMT: {
+            WhileStmt* ws = static_cast<WhileStmt*>(s);
+            write_expr(w, ws->condition);
+            write_stmt(w, ws->body);
+            break;
+        }
+        case AstNodeType::FOR_STMT: {
+            ForStmt* fs = static_cast<ForStmt*>(s);
+            write_stmt(w, fs->initializer);
+            write_expr(w, fs->condition);
+            write_expr(w, fs->increment);
+            write_stmt(w, fs->body);
+            break;
+        }
+        case AstNodeType::RETURN_STMT:
+            write_expr(w, static_cast<ReturnStmt*>(s)->value);
+            break;
+        case AstNodeType::BREAK_STMT:
+        case AstNodeType::CONTINUE_STMT:
+            break;
+        case AstNodeType::DEFER_STMT:
+            write_stmt(w, static_cast<DeferStmt*>(s)->statement);
+            break;
+        case AstNodeType::SWITCH_STMT: {
+            SwitchStmt* sw = static_cast<SwitchStmt*>(s);
+            write_expr(w, sw->subject);
+            w.write_u32((uint32_t)sw->cases.size());
+            for (size_t i = 0; i < sw->cases.size(); i++) {
+                SwitchCase* sc = sw->cases[i];
+                w.write_u8(sc->is_default ? 1 : 0);
+                w.write_u32((uint32_t)sc->values.size());
+                for (size_t j = 0; j < sc->values.size(); j++) {
+                    write_expr(w, sc->values[j]);
+                }
+                write_block(w, sc->body);
+            }
+            break;
+        }
+        case AstNodeType::TRY_CATCH_STMT: {
+            TryCatchStmt* tc = static_cast<TryCatchStmt*>(s);
+            write_block(w, tc->try_body);
+            w.write_string(tc->catch_var);
+            w.write_string(tc->catch_type);
+            write_block(w, tc->catch_body);
+            break;
+        }
+        case AstNodeType::THROW_STMT:
+            write_expr(w, static_cast<ThrowStmt*>(s)->value);
+            break;
+        default:
+            break;
+    }
+}
+
+static StmtNode* read_stmt(CacheReader& r, Arena& arena) {
+    uint8_t tag = r.read_u8();
+    if (tag == NULL_TAG) return nullptr;
+    AstNodeType type = (AstNodeType)tag;
+    int line = r.read_i32();
+    StmtNode* node = nullptr;
+
+    switch (type) {
+        case AstNodeType::BLOCK_STMT: {
+            BlockStmt* block = arena.make<BlockStmt>();
+            uint32_t count = r.read_u32();
+            for (uint32_t i = 0; i < count; i++) {
+                block->statements.push(read_stmt(r, arena));
+            }
+            node = block;
+            break;
+        }
+        case AstNodeType::EXPR_STMT:
+            node = arena.make<ExprStmt>(read_expr(r, arena));
+            break;
+        case AstNodeType::VAR_DECL: {
+            String type_name = r.read_string();
+            String name = r.read_string();
+            ExprNode* init = read_expr(r, arena);
+            bool is_const = r.read_u8() != 0;
+            node = arena.make<VarDecl>(type_name, name, init, is_const);
+            break;
+        }
+        case AstNodeType::IF_STMT: {
+            ExprNode* cond = read_expr(r, arena);
+            StmtNode* then_branch = read_stmt(r, arena);
+            StmtNode* else_branch = read_stmt(r, arena);
+            node = arena.make<IfStmt>(cond, then_branch, else_branch);
+            break;
+        }
+        case AstNodeType::WHILE_STMT: {
+            ExprNode* cond = read_expr(r, arena);
+            StmtNode* body = read_stmt(r, arena);
+            node = arena.make<WhileStmt>(cond, body);
+            break;
+        }
+        case AstNodeType::FOR_STMT: {
+            StmtNode* init = read_stmt(r, arena);
+            ExprNode* cond = read_expr(r, arena);
+            ExprNode* incr = read_expr(r, arena);
+            StmtNode* body = read_stmt(r, arena);
+            node = arena.make<ForStmt>(init, cond, incr, body);
+            break;
+        }
+        case AstNodeType::RETURN_STMT:
+            node = arena.make<ReturnStmt>(read_expr(r, arena));
+            break;
+        case AstNodeType::BREAK_STMT:
+            node = arena.make<BreakStmt>();
+            break;
+        case AstNodeType::CONTINUE_STMT:
+            node = arena.make<ContinueStmt>();
+            break;
+        case AstNodeType::DEFER_STMT:
+            node = arena.make<DeferStmt>(read_stmt(r, arena));
+            break;
+        case AstNodeType::SWITCH_STMT: {
+            SwitchStmt* sw = arena.make<SwitchStmt>(read_expr(r, arena));
+            uint32_t case_count = r.read_u32();
+            for (uint32_t i = 0; i < case_count; i++) {
+                SwitchCase* sc = arena.make<SwitchCase>();
+                sc->is_default = r.read_u8() != 0;
+                uint32_t value_count = r.read_u32();
+                for (uint32_t j = 0; j < value_count; j++) {
+                    sc->values.push(read_expr(r, arena));
+                }
+                sc->body = read_block(r, arena);
+                sw->cases.push(sc);
+            }
+            node = sw;
+            break;
+        }
+        case AstNodeType::TRY_CATCH_STMT: {
+            BlockStmt* try_body = read_block(r, arena);
+            String catch_var = r.read_string();
+            String catch_type = r.read_string();
+            BlockStmt* catch_body = read_block(r, arena);
+            node = arena.make<TryCatchStmt>(try_body, catch_var, catch_type, catch_body);
+            break;
+        }
+        case AstNodeType::THROW_STMT:
+            node = arena.make<ThrowStmt>(read_expr(r, arena));
+            break;
+        default:
+            return nullptr;
+    }
+
+    node->line = line;
+    return node;
+}
+
+static void write_parameters(CacheWriter& w, const DynamicArray<Parameter*>& params) {
+    w.write_u32((uint32_t)params.size());
+    for (size_t i = 0; i < params.size(); i++) {
+        w.write_string(params[i]->type_name);
+        w.write_string(params[i]->name);
+    }
+}
+
+static void read_parameters(CacheReader& r, Arena& arena, DynamicArray<Parameter*>& params) {
+    uint32_t count = r.read_u32();
+    for (uint32_t i = 0; i < count; i++) {
+        String type_name = r.read_string();
+        String name = r.read_string();
+        params.push(arena.make<Parameter>(type_name, name));
+    }
+}
+
+static void write_function(CacheWriter& w, FunctionDecl* fn) {
+    w.write_i32(fn->line);
+    w.write_string(fn->return_type);
+    w.write_string(fn->name);
+    w.write_string(fn->class_name);
+    w.write_u8(fn->is_destructor ? 1 : 0);
+    write_parameters(w, fn->parameters);
+    write_block(w, fn->body);
+}
+
+static FunctionDecl* read_function(CacheReader& r, Arena& arena) {
+    int line = r.read_i32();
+    String return_type = r.read_string();
+    String name = r.read_string();
+    String class_name = r.read_string();
+    bool is_destructor = r.read_u8() != 0;
+    FunctionDecl* fn = arena.make<FunctionDecl>(return_type, name, (BlockStmt*)nullptr);
+    fn->line = line;
+    fn->class_name = class_name;
+    fn->is_destructor = is_destructor;
+    read_parameters(r, arena, fn->parameters);
+    fn->body = read_block(r, arena);
+    return fn;
+}
+
+static void write_program(CacheWriter& w, Program* program) {
+    w.write_u32((uint32_t)program->imports.size());
+    for (size_t i = 0; i < program->imports.size(); i++) {
+        ImportDecl* imp = program->imports[i];
+        w.write_i32(imp->line);
+        w.write_string(imp->module_path);
+        w.write_u8(imp->import_all ? 1 : 0);
+        w.write_u32((uint32_t)imp->imported_names.size());
+        for (size_t j = 0; j < imp->imported_names.size(); j++) {
+            w.write_string(imp->imported_names[j]);
+        }
+    }
+
+    w.write_u32((uint32_t)program->globals.size());
+    for (size_t i = 0; i < program->globals.size(); i++) {
+        write_stmt(w, program->globals[i]);
+    }
+
+    w.write_u32((uint32_t)program->events.size());
+    for (size_t i = 0; i < program->events.size(); i++) {
+        w.write_i32(program->events[i]->line);
+        w.write_string(program->events[i]->name);
+    }
+
+    w.write_u32((uint32_t)program->signals.size());
+    for (size_t i = 0; i < program->signals.size(); i++) {
+        SignalDecl* sig = program->signals[i];
+        w.write_i32(sig->line);
+        w.write_string(sig->type_param);
+        w.write_string(sig->name);
+        w.write_i32(sig->array_size);
+    }
+
+    w.write_u32((uint32_t)program->processes.size());
+    for (size_t i = 0; i < program->processes.size(); i++) {
+        ProcessDecl* proc = program->processes[i];
+        w.write_i32(proc->line);
+        w.write_string(proc->event_name);
+        w.write_string(proc->name);
+        write_block(w, proc->body);
+    }
+
+    w.write_u32((uint32_t)program->functions.size());
+    for (size_t i = 0; i < program->functions.size(); i++) {
+        write_function(w, program->functions[i]);
+    }
+
+    w.write_u32((uint32_t)program->methods.size());
+    for (size_t i = 0; i < program->methods.size(); i++) {
+        write_function(w, program->methods[i]);
+    }
+
+    w.write_u32((uint32_t)program->classes.size());
+    for (size_t i = 0; i < program->classes.size(); i++) {
+        ClassDecl* cls = program->classes[i];
+        w.write_i32(cls->line);
+        w.write_string(cls->name);
+        w.write_string(cls->base_class);
+        w.write_u8(cls->is_dataclass ? 1 : 0);
+        w.write_u32((uint32_t)cls->interfaces.size());
+        for (size_t j = 0; j < cls->interfaces.size(); j++) {
+            w.write_string(cls->interfaces[j]);
+        }
+        w.write_u32((uint32_t)cls->fields.size());
+        for (size_t j = 0; j < cls->fields.size(); j++) {
+            write_stmt(w, cls->fields[j]);
+        }
+    }
+
+    w.write_u32((uint32_t)program->enums.size());
+    for (size_t i = 0; i < program->enums.size(); i++) {
+        EnumDecl* ed = program->enums[i];
+        w.write_i32(ed->line);
+        w.write_string(ed->name);
+        w.write_u32((uint32_t)ed->values.size());
+        for (size_t j = 0; j < ed->values.size(); j++) {
+            w.write_string(ed->values[j]->name);
+            w.write_i32(ed->values[j]->value);
+            w.write_u8(ed->values[j]->has_value ? 1 : 0);
+        }
+    }
+
+    w.write_u32((uint32_t)program->unions.size());
+    for (size_t i = 0; i < program->unions.size(); i++) {
+        UnionDecl* ud = program->unions[i];
+        w.write_i32(ud->line);
+        w.write_string(ud->name);
+        w.write_u32((uint32_t)ud->fields.size());
+        for (size_t j = 0; j < ud->fields.size(); j++) {
+            w.write_string(ud->fields[j]->type_name);
+            w.write_string(ud->fields[j]->name);
+        }
+    }
+
+    w.write_u32((uint32_t)program->interfaces.size());
+    for (size_t i = 0; i < program->interfaces.size(); i++) {
+        InterfaceDecl* iface = program->interfaces[i];
+        w.write_i32(iface->line);
+        w.write_string(iface->name);
+        w.write_u32((uint32_t)iface->methods.size());
+        for (size_t j = 0; j < iface->methods.size(); j++) {
+            InterfaceMethod* method = iface->methods[j];
+            w.write_string(method->name);
+            w.write_string(method->return_type);
+            write_parameters(w, method->parameters);
+        }
+    }
+
+    w.write_u32((uint32_t)program->extern_functions.size());
+    for (size_t i = 0; i < program->extern_functions.size(); i++) {
+        ExternFuncDecl* fn = program->extern_functions[i];
+        w.write_i32(fn->line);
+        w.write_string(fn->return_type);
+        w.write_string(fn->name);
+        write_parameters(w, fn->parameters);
+    }
+
+    w.write_u32((uint32_t)program->link_flags.size());
+    for (size_t i = 0; i < program->link_flags.size(); i++) {
+        w.write_string(program->link_flags[i]);
+    }
+}
+
+static Program* read_program(CacheReader& r) {
+    Program* program = new Program();
+    Arena& arena = program->arena;
+
+    uint32_t import_count = r.read_u32();
+    for (uint32_t i = 0; i < import_count; i++) {
+        int line = r.read_i32();
+        ImportDecl* imp = arena.make<ImportDecl>(r.read_string());
+        imp->line = line;
+        imp->import_all = r.read_u8() != 0;
+        uint32_t name_count = r.read_u32();
+        for (uint32_t j = 0; j < name_count; j++) {
+            imp->imported_names.push(r.read_string());
+        }
+        program->imports.push(imp);
+    }
+
+    uint32_t global_count = r.read_u32();
+    for (uint32_t i = 0; i < global_count; i++) {
+        program->globals.push(static_cast<VarDecl*>(read_stmt(r, arena)));
+    }
+
+    uint32_t event_count = r.read_u32();
+    for (uint32_t i = 0; i < event_count; i++) {
+        int line = r.read_i32();
+        EventDecl* evt = arena.make<EventDecl>(r.read_string());
+        evt->line = line;
+        program->events.push(evt);
+    }
+
+    uint32_t signal_count = r.read_u32();
+    for (uint32_t i = 0; i < signal_count; i++) {
+        int line = r.read_i32();
+        String type_param = r.read_string();
+        String name = r.read_string();
+        int array_size = r.read_i32();
+        SignalDecl* sig = arena.make<SignalDecl>(type_param, name, array_size);
+        sig->line = line;
+        program->signals.push(sig);
+    }
+
+    uint32_t process_count = r.read_u32();
+    for (uint32_t i = 0; i < process_count; i++) {
+        int line = r.read_i32();
+        String event_name = r.read_string();
+        String name = r.read_string();
+        BlockStmt* body = read_block(r, arena);
+        ProcessDecl* proc = arena.make<ProcessDecl>(event_name, name, body);
+        proc->line = line;
+        program->processes.push(proc);
+    }
+
+    uint32_t func_count = r.read_u32();
+    for (uint32_t i = 0; i < func_count; i++) {
+        program->functions.push(read_function(r, arena));
+    }
+
+    uint32_t method_count = r.read_u32();
+    for (uint32_t i = 0; i < method_count; i++) {
+        program->methods.push(read_function(r, arena));
+    }
+
+    uint32_t class_count = r.read_u32();
+    for (uint32_t i = 0; i < class_count; i++) {
+        int line = r.read_i32();
+        ClassDecl* cls = arena.make<ClassDecl>(r.read_string());
+        cls->line = line;
+        cls->base_class = r.read_string();
+        cls->is_dataclass = r.read_u8() != 0;
+        uint32_t iface_count = r.read_u32();
+        for (uint32_t j = 0; j < iface_count; j++) {
+            cls->interfaces.push(r.read_string());
+        }
+        uint32_t field_count = r.read_u32();
+        for (uint32_t j = 0; j < field_count; j++) {
+            cls->fields.push(static_cast<VarDecl*>(read_stmt(r, arena)));
+        }
+        program->classes.push(cls);
+    }
+
+    uint32_t enum_count = r.read_u32();
+    for (uint32_t i = 0; i < enum_count; i++) {
+        int line = r.read_i32();
+        EnumDecl* ed = arena.make<EnumDecl>(r.read_string());
+        ed->line = line;
+        uint32_t value_count = r.read_u32();
+        for (uint32_t j = 0; j < value_count; j++) {
+            String name = r.read_string();
+            int value = r.read_i32();
+            bool has_value = r.read_u8() != 0;
+            EnumValue* ev = has_value ? arena.make<EnumValue>(name, value)
+                                      : arena.make<EnumValue>(name);
+            ed->values.push(ev);
+        }
+        program->enums.push(ed);
+    }
+
+    uint32_t union_count = r.read_u32();
+    for (uint32_t i = 0; i < union_count; i++) {
+        int line = r.read_i32();
+        UnionDecl* ud = arena.make<UnionDecl>(r.read_string());
+        ud->line = line;
+        uint32_t field_count = r.read_u32();
+        for (uint32_t j = 0; j < field_count; j++) {
+            String type_name = r.read_string();
+            String name = r.read_string();
+            ud->fields.push(arena.make<UnionField>(type_name, name));
+        }
+        program->unions.push(ud);
+    }
+
+    uint32_t iface_count = r.read_u32();
+    for (uint32_t i = 0; i < iface_count; i++) {
+        int line = r.read_i32();
+        InterfaceDecl* iface = arena.make<InterfaceDecl>(r.read_string());
+        iface->line = line;
+        uint32_t method_count2 = r.read_u32();
+        for (uint32_t j = 0; j < method_count2; j++) {
+            String name = r.read_string();
+            String return_type = r.read_string();
+            InterfaceMethod* method = arena.make<InterfaceMethod>(name, return_type);
+            read_parameters(r, arena, method->parameters);
+            iface->methods.push(method);
+        }
+        program->interfaces.push(iface);
+    }
+
+    uint32_t extern_count = r.read_u32();
+    for (uint32_t i = 0; i < extern_count; i++) {
+        int line = r.read_i32();
+        String return_type = r.read_string();
+        String name = r.read_string();
+        ExternFuncDecl* fn = arena.make<ExternFuncDecl>(return_type, name);
+        fn->line = line;
+        read_parameters(r, arena, fn->parameters);
+        program->extern_functions.push(fn);
+    }
+
+    uint32_t flag_count = r.read_u32();
+    for (uint32_t i = 0; i < flag_count; i++) {
+        program->link_flags.push(r.read_string());
+    }
+
+    return program;
+}
+
+Program* ModuleCache::load(const char* source_path) {
+    struct stat source_st;
+    if (stat(source_path, &source_st) != 0) {
+        return nullptr;
+    }
+
+    char cache_path[1024];
+    cache_path_for(source_path, cache_path, sizeof(cache_path));
+
+    SourceFile cache_file;
+    if (!SourceLoader::load(cache_path, &cache_file)) {
+        return nullptr;
+    }
+
+    if (cache_file.size < sizeof(CacheHeader)) {
+        SourceLoader::unload(&cache_file);
+        return nullptr;
+    }
+
+    CacheHeader header;
+    memcpy(&header, cache_file.data, sizeof(header));
+    if (header.magic != CACHE_MAGIC || header.version != CACHE_VERSION) {
+        SourceLoader::unload(&cache_file);
+        return nullptr;
+    }
+
+    bool valid = header.source_size == (uint64_t)source_st.st_size &&
+                 header.source_mtime == (uint64_t)source_st.st_mtime;
+    if (!valid && header.source_size == (uint64_t)source_st.st_size) {
+        SourceFile source;
+        if (SourceLoader::load(source_path, &source)) {
+            valid = hash_source(source.data, source.size) == header.source_hash;
+            SourceLoader::unload(&source);
+        }
+    }
+
+    if (!valid) {
+        SourceLoader::unload(&cache_file);
+        return nullptr;
+    }
+
+    CacheReader reader(cache_file.data, sizeof(CacheHeader));
+    Program* program = read_program(reader);
+    SourceLoader::unload(&cache_file);
+    return program;
+}
+
+void ModuleCache::store(const char* source_path, Program* program) {
+    struct stat source_st;
+    if (stat(source_path, &source_st) != 0) {
+        return;
+    }
+
+    SourceFile source;
+    if (!SourceLoader::load(source_path, &source)) {
+        return;
+    }
+
+    CacheHeader header;
+    header.magic = CACHE_MAGIC;
+    header.version = CACHE_VERSION;
+    header.source_size = (uint64_t)source_st.st_size;
+    header.source_mtime = (uint64_t)source_st.st_mtime;
+    header.source_hash = hash_source(source.data, source.size);
+    SourceLoader::unload(&source);
+
+    CacheWriter writer;
+    write_program(writer, program);
+
+    char cache_path[1024];
+    cache_path_for(source_path, cache_path, sizeof(cache_path));
+
+    char temp_path[1088];
+    snprintf(temp_path, sizeof(temp_path), "%s.%d.tmp", cache_path, getpid());
+    FILE* f = fopen(temp_path, "wb");
+    if (!f) {
+        return;
+    }
+    fwrite(&header, sizeof(header), 1, f);
+    fwrite(writer.data, 1, writer.size, f);
+    fclose(f);
+
+    if (rename(temp_path, cache_path) != 0) {
+        remove(temp_path);
+    }
+}
+
+}
@@ -0,0 +1,16 @@
+#ifndef TICK_MODULE_CACHE_H
+#define TICK_MODULE_CACHE_H
+
+#include "ast.h"
+
+namespace Tick {
+
+class ModuleCache {
+public:
+    static Program* load(const char* source_path);
+    static void store(const char* source_path, Program* program);
+};
+
+}
+
+#endif
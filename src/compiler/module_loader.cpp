@@ -1,19 +1,36 @@
 #include "module_loader.h"
+#include "module_cache.h"
 #include "lexer.h"
 #include "parser.h"
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <unistd.h>
 #include <sys/stat.h>
 
 namespace Tick {
 
-ModuleLoader::ModuleLoader() {}
+ModuleLoader::ModuleLoader() : _preload_head(0), _preload_active(0) {
+    pthread_mutex_init(&_preload_mutex, nullptr);
+    pthread_cond_init(&_preload_cond, nullptr);
+}
 
 ModuleLoader::~ModuleLoader() {
     _loaded_modules.for_each([](const char* name, Program* program) {
         delete program;
     });
+    for (size_t i = 0; i < _sources.size(); i++) {
+        SourceLoader::unload(&_sources[i]);
+    }
+    for (size_t i = 0; i < _preload_queue.size(); i++) {
+        free(_preload_queue[i].name);
+        free(_preload_queue[i].base_path);
+    }
+    _preload_started.for_each([](const char* name, const bool&) {
+        free((void*)name);
+    });
+    pthread_mutex_destroy(&_preload_mutex);
+    pthread_cond_destroy(&_preload_cond);
 }
 
 String ModuleLoader::resolve_module_path(const char* module_name, const char* current_file_path) {
@@ -65,41 +82,111 @@ String ModuleLoader::resolve_module_path(const char* module_name, const char* cu
     return String("");
 }
 
-char* ModuleLoader::read_file(const char* path) {
-    FILE* file = fopen(path, "rb");
-    if (!file) {
-        return nullptr;
+Program* ModuleLoader::parse_module(const char* path) {
+    Program* cached = ModuleCache::load(path);
+    if (cached) {
+        return cached;
     }
-    
-    fseek(file, 0, SEEK_END);
-    long file_size = ftell(file);
-    fseek(file, 0, SEEK_SET);
-    
-    char* buffer = (char*)malloc(file_size + 1);
-    fread(buffer, 1, file_size, file);
-    buffer[file_size] = '\0';
-    
-    fclose(file);
-    return buffer;
-}
 
-Program* ModuleLoader::parse_module(const char* path) {
-    char* source = read_file(path);
-    if (!source) {
+    SourceFile source;
+    if (!SourceLoader::load(path, &source)) {
         fprintf(stderr, "Error: Could not read module file '%s'\n", path);
         return nullptr;
     }
-    
-    Lexer lexer(source);
+
+    Lexer lexer(source.data);
     DynamicArray<Token> tokens = lexer.tokenize();
-    
+
     Parser parser(tokens);
     Program* program = parser.parse();
-    
-    free(source);
+
+    pthread_mutex_lock(&_preload_mutex);
+    _sources.push(source);
+    pthread_mutex_unlock(&_preload_mutex);
+    ModuleCache::store(path, program);
     return program;
 }
 
+void ModuleLoader::enqueue_imports(Program* program, const char* base_path) {
+    for (size_t i = 0; i < program->imports.size(); i++) {
+        if (!program->imports[i]) continue;
+        const char* name = program->imports[i]->module_path.c_str();
+        if (_loaded_modules.contains(name) || _preload_started.contains(name)) {
+            continue;
+        }
+        _preload_started.insert(strdup(name), true);
+
+        PreloadItem item;
+        item.name = strdup(name);
+        item.base_path = strdup(base_path);
+        _preload_queue.push(item);
+    }
+}
+
+void ModuleLoader::preload_loop() {
+    for (;;) {
+        pthread_mutex_lock(&_preload_mutex);
+        while (_preload_head >= _preload_queue.size() && _preload_active > 0) {
+            pthread_cond_wait(&_preload_cond, &_preload_mutex);
+        }
+        if (_preload_head >= _preload_queue.size()) {
+            pthread_mutex_unlock(&_preload_mutex);
+            return;
+        }
+        PreloadItem item = _preload_queue[_preload_head++];
+        _preload_active++;
+        pthread_mutex_unlock(&_preload_mutex);
+
+        String module_path = resolve_module_path(item.name, item.base_path);
+        Program* program = nullptr;
+        if (module_path.length() > 0) {
+            program = parse_module(module_path.c_str());
+        }
+
+        pthread_mutex_lock(&_preload_mutex);
+        if (program && !_loaded_modules.contains(item.name)) {
+            _loaded_modules.insert(strdup(item.name), program);
+            enqueue_imports(program, module_path.c_str());
+        }
+        _preload_active--;
+        pthread_cond_broadcast(&_preload_cond);
+        pthread_mutex_unlock(&_preload_mutex);
+    }
+}
+
+void* ModuleLoader::preload_worker(void* arg) {
+    ((ModuleLoader*)arg)->preload_loop();
+    return nullptr;
+}
+
+void ModuleLoader::preload(Program* program, const char* current_file_path) {
+    pthread_mutex_lock(&_preload_mutex);
+    enqueue_imports(program, current_file_path);
+    size_t pending = _preload_queue.size() - _preload_head;
+    pthread_mutex_unlock(&_preload_mutex);
+
+    if (pending == 0) {
+        return;
+    }
+    if (pending == 1) {
+        preload_loop();
+        return;
+    }
+
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t worker_count = cores > 1 ? (size_t)cores : 1;
+    if (worker_count > pending) worker_count = pending;
+
+    pthread_t* threads = (pthread_t*)malloc(sizeof(pthread_t) * worker_count);
+    for (size_t i = 0; i < worker_count; i++) {
+        pthread_create(&threads[i], nullptr, preload_worker, this);
+    }
+    for (size_t i = 0; i < worker_count; i++) {
+        pthread_join(threads[i], nullptr);
+    }
+    free(threads);
+}
+
 Program* ModuleLoader::load_module(const char* module_name, const char* current_file_path) {
     if (is_module_loaded(module_name)) {
         return get_loaded_module(module_name);
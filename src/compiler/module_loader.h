@@ -2,9 +2,11 @@
 #define TICK_MODULE_LOADER_H
 
 #include "ast.h"
+#include "source_file.h"
 #include "../core/string.h"
 #include "../core/hash_map.h"
 #include "../core/dynamic_array.h"
+#include <pthread.h>
 
 namespace Tick {
 
@@ -14,14 +16,31 @@ public:
     ~ModuleLoader();
     
     Program* load_module(const char* module_name, const char* current_file_path);
+    void preload(Program* program, const char* current_file_path);
     bool is_module_loaded(const char* module_name);
     Program* get_loaded_module(const char* module_name);
     String resolve_module_path(const char* module_name, const char* current_file_path);
+    size_t loaded_module_count() const { return _loaded_modules.size(); }
 
 private:
+    struct PreloadItem {
+        char* name;
+        char* base_path;
+    };
+
     HashMap<const char*, Program*> _loaded_modules;
-    char* read_file(const char* path);
+    HashMap<const char*, bool> _preload_started;
+    DynamicArray<SourceFile> _sources;
+    DynamicArray<PreloadItem> _preload_queue;
+    size_t _preload_head;
+    size_t _preload_active;
+    pthread_mutex_t _preload_mutex;
+    pthread_cond_t _preload_cond;
+
     Program* parse_module(const char* path);
+    void enqueue_imports(Program* program, const char* base_path);
+    void preload_loop();
+    static void* preload_worker(void* arg);
 };
 
 }
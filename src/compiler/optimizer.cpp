@@ -0,0 +1,586 @@
+#include "optimizer.h"
+
+#include <cstdint>
+
+using namespace Tick;
+
+Optimizer::Optimizer() : _program(nullptr) {}
+
+void Optimizer::optimize(Program* program) {
+    _program = program;
+
+    for (size_t i = 0; i < program->globals.size(); i++) {
+        VarDecl* var = program->globals[i];
+        if (var->initializer) {
+            var->initializer = fold_expr(var->initializer);
+        }
+        if (var->is_const) {
+            bind_const(var);
+        }
+    }
+
+    size_t global_consts = _consts.size();
+
+    for (size_t i = 0; i < program->functions.size(); i++) {
+        shadow_parameters(program->functions[i]);
+        fold_block(program->functions[i]->body);
+        while (_consts.size() > global_consts) _consts.pop_back();
+    }
+    for (size_t i = 0; i < program->methods.size(); i++) {
+        shadow_parameters(program->methods[i]);
+        fold_block(program->methods[i]->body);
+        while (_consts.size() > global_consts) _consts.pop_back();
+    }
+    for (size_t i = 0; i < program->processes.size(); i++) {
+        fold_block(program->processes[i]->body);
+        while (_consts.size() > global_consts) _consts.pop_back();
+    }
+
+    prune_dead_functions(program);
+}
+
+bool Optimizer::literal_matches_type(ExprNode* literal, const String& type_name) {
+    switch (literal->type) {
+        case AstNodeType::INTEGER_LITERAL:
+            return type_name == "i8" || type_name == "i16" || type_name == "i32" ||
+                   type_name == "i64" || type_name == "u8" || type_name == "u16" ||
+                   type_name == "u32" || type_name == "u64";
+        case AstNodeType::BOOL_LITERAL:
+            return type_name == "b8";
+        case AstNodeType::FLOAT_LITERAL:
+            return type_name == "f32";
+        case AstNodeType::DOUBLE_LITERAL:
+            return type_name == "f64";
+        case AstNodeType::STRING_LITERAL:
+            return type_name == "str";
+        default:
+            return false;
+    }
+}
+
+void Optimizer::bind_const(VarDecl* decl) {
+    if (!decl->initializer) return;
+    if (!literal_matches_type(decl->initializer, decl->type_name)) return;
+    ConstBinding binding;
+    binding.name = decl->name;
+    binding.value = decl->initializer;
+    _consts.push(binding);
+}
+
+ExprNode* Optimizer::lookup_const(const String& name) {
+    for (size_t i = _consts.size(); i > 0; i--) {
+        if (_consts[i - 1].name == name) return _consts[i - 1].value;
+    }
+    return nullptr;
+}
+
+ExprNode* Optimizer::fold_binary(BinaryExpr* bin) {
+    bin->left = fold_expr(bin->left);
+    bin->right = fold_expr(bin->right);
+
+    if (bin->left->type == AstNodeType::INTEGER_LITERAL &&
+        bin->right->type == AstNodeType::INTEGER_LITERAL) {
+        int64_t l = static_cast<IntegerLiteral*>(bin->left)->value;
+        int64_t r = static_cast<IntegerLiteral*>(bin->right)->value;
+        int64_t result;
+        if (bin->op == "+") result = l + r;
+        else if (bin->op == "-") result = l - r;
+        else if (bin->op == "*") result = l * r;
+        else if (bin->op == "/" && r != 0) result = l / r;
+        else if (bin->op == "%" && r != 0) result = l % r;
+        else if (bin->op == "<<" && r >= 0 && r < 32) result = l << r;
+        else if (bin->op == ">>" && r >= 0 && r < 32) result = l >> r;
+        else if (bin->op == "&") result = l & r;
+        else if (bin->op == "|") result = l | r;
+        else if (bin->op == "^") result = l ^ r;
+        else if (bin->op == "<") return _program->arena.make<BoolLiteral>(l < r);
+        else if (bin->op == "<=") return _program->arena.make<BoolLiteral>(l <= r);
+        else if (bin->op == ">") return _program->arena.make<BoolLiteral>(l > r);
+        else if (bin->op == ">=") return _program->arena.make<BoolLiteral>(l >= r);
+        else if (bin->op == "==") return _program->arena.make<BoolLiteral>(l == r);
+        else if (bin->op == "!=") return _program->arena.make<BoolLiteral>(l != r);
+        else return bin;
+        if (result < INT32_MIN || result > INT32_MAX) return bin;
+        return _program->arena.make<IntegerLiteral>((int)result);
+    }
+
+    if (bin->left->type == AstNodeType::BOOL_LITERAL &&
+        bin->right->type == AstNodeType::BOOL_LITERAL) {
+        bool l = static_cast<BoolLiteral*>(bin->left)->value;
+        bool r = static_cast<BoolLiteral*>(bin->right)->value;
+        if (bin->op == "&&") return _program->arena.make<BoolLiteral>(l && r);
+        if (bin->op == "||") return _program->arena.make<BoolLiteral>(l || r);
+        if (bin->op == "==") return _program->arena.make<BoolLiteral>(l == r);
+        if (bin->op == "!=") return _program->arena.make<BoolLiteral>(l != r);
+        return bin;
+    }
+
+    if (bin->left->type == AstNodeType::DOUBLE_LITERAL &&
+        bin->right->type == AstNodeType::DOUBLE_LITERAL) {
+        double l = static_cast<DoubleLiteral*>(bin->left)->value;
+        double r = static_cast<DoubleLiteral*>(bin->right)->value;
+        if (bin->op == "+") return _program->arena.make<DoubleLiteral>(l + r);
+        if (bin->op == "-") return _program->arena.make<DoubleLiteral>(l - r);
+        if (bin->op == "*") return _program->arena.make<DoubleLiteral>(l * r);
+        if (bin->op == "/" && r != 0.0) return _program->arena.make<DoubleLiteral>(l / r);
+        return bin;
+    }
+
+    if (bin->op == "&&" && bin->left->type == AstNodeType::BOOL_LITERAL) {
+        return static_cast<BoolLiteral*>(bin->left)->value
+            ? bin->right
+            : bin->left;
+    }
+    if (bin->op == "||" && bin->left->type == AstNodeType::BOOL_LITERAL) {
+        return static_cast<BoolLiteral*>(bin->left)->value
+            ? bin->left
+            : bin->right;
+    }
+
+    return bin;
+}
+
+void Optimizer::shadow_parameters(FunctionDecl* func) {
+    for (size_t i = 0; i < func->parameters.size(); i++) {
+        ConstBinding shadow;
+        shadow.name = func->parameters[i]->name;
+        shadow.value = nullptr;
+        _consts.push(shadow);
+    }
+}
+
+ExprNode* Optimizer::fold_unary(UnaryExpr* unary) {
+    if (unary->op == "++" || unary->op == "--") return unary;
+    unary->operand = fold_expr(unary->operand);
+
+    if (unary->operand->type == AstNodeType::INTEGER_LITERAL) {
+        int64_t v = static_cast<IntegerLiteral*>(unary->operand)->value;
+        if (unary->op == "-" && -v >= INT32_MIN && -v <= INT32_MAX) {
+            return _program->arena.make<IntegerLiteral>((int)-v);
+        }
+        if (unary->op == "~") {
+            return _program->arena.make<IntegerLiteral>((int)~v);
+        }
+    }
+    if (unary->operand->type == AstNodeType::BOOL_LITERAL && unary->op == "!") {
+        return _program->arena.make<BoolLiteral>(!static_cast<BoolLiteral*>(unary->operand)->value);
+    }
+    if (unary->operand->type == AstNodeType::DOUBLE_LITERAL && unary->op == "-") {
+        return _program->arena.make<DoubleLiteral>(-static_cast<DoubleLiteral*>(unary->operand)->value);
+    }
+    return unary;
+}
+
+ExprNode* Optimizer::fold_expr(ExprNode* expr) {
+    if (!expr) return nullptr;
+    switch (expr->type) {
+        case AstNodeType::IDENTIFIER_EXPR: {
+            ExprNode* value = lookup_const(static_cast<IdentifierExpr*>(expr)->name);
+            return value ? value : expr;
+        }
+
+        case AstNodeType::BINARY_EXPR:
+            return fold_binary(static_cast<BinaryExpr*>(expr));
+
+        case AstNodeType::UNARY_EXPR:
+            return fold_unary(static_cast<UnaryExpr*>(expr));
+
+        case AstNodeType::ASSIGN_EXPR: {
+            AssignExpr* assign = static_cast<AssignExpr*>(expr);
+            assign->value = fold_expr(assign->value);
+            return assign;
+        }
+
+        case AstNodeType::COMPOUND_ASSIGN_EXPR: {
+            CompoundAssignExpr* assign = static_cast<CompoundAssignExpr*>(expr);
+            assign->value = fold_expr(assign->value);
+            return assign;
+        }
+
+        case AstNodeType::CALL_EXPR: {
+            CallExpr* call = static_cast<CallExpr*>(expr);
+            for (size_t i = 0; i < call->arguments.size(); i++) {
+                call->arguments[i] = fold_expr(call->arguments[i]);
+            }
+            return call;
+        }
+
+        case AstNodeType::INDEX_EXPR: {
+            IndexExpr* index = static_cast<IndexExpr*>(expr);
+            index->index = fold_expr(index->index);
+            return index;
+        }
+
+        case AstNodeType::ARRAY_EXPR: {
+            ArrayExpr* arr = static_cast<ArrayExpr*>(expr);
+            for (size_t i = 0; i < arr->elements.size(); i++) {
+                arr->elements[i] = fold_expr(arr->elements[i]);
+            }
+            return arr;
+        }
+
+        case AstNodeType::NEW_EXPR: {
+            NewExpr* ne = static_cast<NewExpr*>(expr);
+            for (size_t i = 0; i < ne->arguments.size(); i++) {
+                ne->arguments[i] = fold_expr(ne->arguments[i]);
+            }
+            return ne;
+        }
+
+        case AstNodeType::CAST_EXPR: {
+            CastExpr* cast = static_cast<CastExpr*>(expr);
+            cast->expression = fold_expr(cast->expression);
+            return cast;
+        }
+
+        default:
+            return expr;
+    }
+}
+
+bool Optimizer::terminates_block(StmtNode* stmt) {
+    return stmt->type == AstNodeType::RETURN_STMT ||
+           stmt->type == AstNodeType::BREAK_STMT ||
+           stmt->type == AstNodeType::CONTINUE_STMT ||
+           stmt->type == AstNodeType::THROW_STMT;
+}
+
+void Optimizer::fold_block(BlockStmt* block) {
+    if (!block) return;
+    size_t scope_start = _consts.size();
+    DynamicArray<StmtNode*> kept;
+    for (size_t i = 0; i < block->statements.size(); i++) {
+        StmtNode* folded = fold_stmt(block->statements[i]);
+        if (!folded) continue;
+        kept.push(folded);
+        if (terminates_block(folded)) break;
+    }
+    block->statements = kept;
+    while (_consts.size() > scope_start) _consts.pop_back();
+}
+
+StmtNode* Optimizer::fold_stmt(StmtNode* stmt) {
+    if (!stmt) return nullptr;
+    switch (stmt->type) {
+        case AstNodeType::BLOCK_STMT:
+            fold_block(static_cast<BlockStmt*>(stmt));
+            return stmt;
+
+        case AstNodeType::VAR_DECL: {
+            VarDecl* decl = static_cast<VarDecl*>(stmt);
+            if (decl->initializer) {
+                decl->initializer = fold_expr(decl->initializer);
+            }
+            if (decl->is_const) {
+                bind_const(decl);
+            } else {
+                ConstBinding shadow;
+                shadow.name = decl->name;
+                shadow.value = nullptr;
+                _consts.push(shadow);
+            }
+            return decl;
+        }
+
+        case AstNodeType::EXPR_STMT: {
+            ExprStmt* es = static_cast<ExprStmt*>(stmt);
+            es->expression = fold_expr(es->expression);
+            return es;
+        }
+
+        case AstNodeType::IF_STMT: {
+            IfStmt* is = static_cast<IfStmt*>(stmt);
+            is->condition = fold_expr(is->condition);
+            if (is->condition->type == AstNodeType::BOOL_LITERAL) {
+                if (static_cast<BoolLiteral*>(is->condition)->value) {
+                    return fold_stmt(is->then_branch);
+                }
+                return is->else_branch ? fold_stmt(is->else_branch) : nullptr;
+            }
+            is->then_branch = fold_stmt(is->then_branch);
+            if (is->else_branch) {
+                is->else_branch = fold_stmt(is->else_branch);
+            }
+            return is;
+        }
+
+        case AstNodeType::WHILE_STMT: {
+            WhileStmt* ws = static_cast<WhileStmt*>(stmt);
+            ws->condition = fold_expr(ws->condition);
+            if (ws->condition->type == AstNodeType::BOOL_LITERAL &&
+                !static_cast<BoolLiteral*>(ws->condition)->value) {
+                return nullptr;
+            }
+            ws->body = fold_stmt(ws->body);
+            return ws;
+        }
+
+        case AstNodeType::FOR_STMT: {
+            ForStmt* fs = static_cast<ForStmt*>(stmt);
+            size_t scope_start = _consts.size();
+            fs->initializer = fold_stmt(fs->initializer);
+            fs->condition = fold_expr(fs->condition);
+            fs->increment = fold_expr(fs->increment);
+            fs->body = fold_stmt(fs->body);
+            while (_consts.size() > scope_start) _consts.pop_back();
+            return fs;
+        }
+
+        case AstNodeType::RETURN_STMT: {
+            ReturnStmt* ret = static_cast<ReturnStmt*>(stmt);
+            if (ret->value) {
+                ret->value = fold_expr(ret->value);
+            }
+            return ret;
+        }
+
+        case AstNodeType::THROW_STMT: {
+            ThrowStmt* ts = static_cast<ThrowStmt*>(stmt);
+            ts->value = fold_expr(ts->value);
+            return ts;
+        }
+
+        case AstNodeType::DEFER_STMT: {
+            DeferStmt* ds = static_cast<DeferStmt*>(stmt);
+            ds->statement = fold_stmt(ds->statement);
+            return ds->statement ? ds : nullptr;
+        }
+
+        case AstNodeType::SWITCH_STMT: {
+            SwitchStmt* ss = static_cast<SwitchStmt*>(stmt);
+            ss->subject = fold_expr(ss->subject);
+            for (size_t i = 0; i < ss->cases.size(); i++) {
+                fold_block(ss->cases[i]->body);
+            }
+            return ss;
+        }
+
+        case AstNodeType::TRY_CATCH_STMT: {
+            TryCatchStmt* tc = static_cast<TryCatchStmt*>(stmt);
+            fold_block(tc->try_body);
+            ConstBinding shadow;
+            shadow.name = tc->catch_var;
+            shadow.value = nullptr;
+            _consts.push(shadow);
+            fold_block(tc->catch_body);
+            _consts.pop_back();
+            return tc;
+        }
+
+        default:
+            return stmt;
+    }
+}
+
+bool Optimizer::is_function_used(const String& name) {
+    for (size_t i = 0; i < _used_functions.size(); i++) {
+        if (_used_functions[i] == name) return true;
+    }
+    return false;
+}
+
+void Optimizer::mark_used_expr(ExprNode* expr) {
+    if (!expr) return;
+    switch (expr->type) {
+        case AstNodeType::IDENTIFIER_EXPR: {
+            const String& name = static_cast<IdentifierExpr*>(expr)->name;
+            if (is_function_used(name)) return;
+            for (size_t i = 0; i < _program->functions.size(); i++) {
+                if (_program->functions[i]->name == name) {
+                    _used_functions.push(name);
+                    _work_queue.push(_program->functions[i]);
+                    return;
+                }
+            }
+            break;
+        }
+
+        case AstNodeType::BINARY_EXPR: {
+            BinaryExpr* bin = static_cast<BinaryExpr*>(expr);
+            mark_used_expr(bin->left);
+            mark_used_expr(bin->right);
+            break;
+        }
+
+        case AstNodeType::UNARY_EXPR:
+            mark_used_expr(static_cast<UnaryExpr*>(expr)->operand);
+            break;
+
+        case AstNodeType::POSTFIX_EXPR:
+            mark_used_expr(static_cast<PostfixExpr*>(expr)->operand);
+            break;
+
+        case AstNodeType::ASSIGN_EXPR: {
+            AssignExpr* assign = static_cast<AssignExpr*>(expr);
+            mark_used_expr(assign->target);
+            mark_used_expr(assign->value);
+            break;
+        }
+
+        case AstNodeType::COMPOUND_ASSIGN_EXPR: {
+            CompoundAssignExpr* assign = static_cast<CompoundAssignExpr*>(expr);
+            mark_used_expr(assign->target);
+            mark_used_expr(assign->value);
+            break;
+        }
+
+        case AstNodeType::CALL_EXPR: {
+            CallExpr* call = static_cast<CallExpr*>(expr);
+            mark_used_expr(call->callee);
+            for (size_t i = 0; i < call->arguments.size(); i++) {
+                mark_used_expr(call->arguments[i]);
+            }
+            break;
+        }
+
+        case AstNodeType::MEMBER_EXPR:
+            mark_used_expr(static_cast<MemberExpr*>(expr)->object);
+            break;
+
+        case AstNodeType::INDEX_EXPR: {
+            IndexExpr* index = static_cast<IndexExpr*>(expr);
+            mark_used_expr(index->array);
+            mark_used_expr(index->index);
+            break;
+        }
+
+        case AstNodeType::ARRAY_EXPR: {
+            ArrayExpr* arr = static_cast<ArrayExpr*>(expr);
+            for (size_t i = 0; i < arr->elements.size(); i++) {
+                mark_used_expr(arr->elements[i]);
+            }
+            break;
+        }
+
+        case AstNodeType::NEW_EXPR: {
+            NewExpr* ne = static_cast<NewExpr*>(expr);
+            for (size_t i = 0; i < ne->arguments.size(); i++) {
+                mark_used_expr(ne->arguments[i]);
+            }
+            break;
+        }
+
+        case AstNodeType::CAST_EXPR:
+            mark_used_expr(static_cast<CastExpr*>(expr)->expression);
+            break;
+
+        default:
+            break;
+    }
+}
+
+void Optimizer::mark_used_stmt(StmtNode* stmt) {
+    if (!stmt) return;
+    switch (stmt->type) {
+        case AstNodeType::BLOCK_STMT: {
+            BlockStmt* block = static_cast<BlockStmt*>(stmt);
+            for (size_t i = 0; i < block->statements.size(); i++) {
+                mark_used_stmt(block->statements[i]);
+            }
+            break;
+        }
+
+        case AstNodeType::VAR_DECL:
+            mark_used_expr(static_cast<VarDecl*>(stmt)->initializer);
+            break;
+
+        case AstNodeType::EXPR_STMT:
+            mark_used_expr(static_cast<ExprStmt*>(stmt)->expression);
+            break;
+
+        case AstNodeType::IF_STMT: {
+            IfStmt* is = static_cast<IfStmt*>(stmt);
+            mark_used_expr(is->condition);
+            mark_used_stmt(is->then_branch);
+            mark_used_stmt(is->else_branch);
+            break;
+        }
+
+        case AstNodeType::WHILE_STMT: {
+            WhileStmt* ws = static_cast<WhileStmt*>(stmt);
+            mark_used_expr(ws->condition);
+            mark_used_stmt(ws->body);
+            break;
+        }
+
+        case AstNodeType::FOR_STMT: {
+            ForStmt* fs = static_cast<ForStmt*>(stmt);
+            mark_used_stmt(fs->initializer);
+            mark_used_expr(fs->condition);
+            mark_used_expr(fs->increment);
+            mark_used_stmt(fs->body);
+            break;
+        }
+
+        case AstNodeType::RETURN_STMT:
+            mark_used_expr(static_cast<ReturnStmt*>(stmt)->value);
+            break;
+
+        case AstNodeType::THROW_STMT:
+            mark_used_expr(static_cast<ThrowStmt*>(stmt)->value);
+            break;
+
+        case AstNodeType::DEFER_STMT:
+            mark_used_stmt(static_cast<DeferStmt*>(stmt)->statement);
+            break;
+
+        case AstNodeType::SWITCH_STMT: {
+            SwitchStmt* ss = static_cast<SwitchStmt*>(stmt);
+            mark_used_expr(ss->subject);
+            for (size_t i = 0; i < ss->cases.size(); i++) {
+                for (size_t j = 0; j < ss->cases[i]->values.size(); j++) {
+                    mark_used_expr(ss->cases[i]->values[j]);
+                }
+                mark_used_stmt(ss->cases[i]->body);
+            }
+            break;
+        }
+
+        case AstNodeType::TRY_CATCH_STMT: {
+            TryCatchStmt* tc = static_cast<TryCatchStmt*>(stmt);
+            mark_used_stmt(tc->try_body);
+            mark_used_stmt(tc->catch_body);
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+void Optimizer::prune_dead_functions(Program* program) {
+    FunctionDecl* main_func = nullptr;
+    for (size_t i = 0; i < program->functions.size(); i++) {
+        if (program->functions[i]->name == "main") {
+            main_func = program->functions[i];
+            break;
+        }
+    }
+    if (!main_func) return;
+
+    _used_functions.push(main_func->name);
+    _work_queue.push(main_func);
+    for (size_t i = 0; i < program->globals.size(); i++) {
+        mark_used_expr(program->globals[i]->initializer);
+    }
+    for (size_t i = 0; i < program->processes.size(); i++) {
+        mark_used_stmt(program->processes[i]->body);
+    }
+    for (size_t i = 0; i < program->methods.size(); i++) {
+        mark_used_stmt(program->methods[i]->body);
+    }
+
+    size_t scanned = 0;
+    while (scanned < _work_queue.size()) {
+        mark_used_stmt(_work_queue[scanned]->body);
+        scanned++;
+    }
+
+    DynamicArray<FunctionDecl*> kept;
+    for (size_t i = 0; i < program->functions.size(); i++) {
+        if (is_function_used(program->functions[i]->name)) {
+            kept.push(program->functions[i]);
+        }
+    }
+    program->functions = kept;
+}
@@ -0,0 +1,45 @@
+#ifndef TICK_OPTIMIZER_H
+#define TICK_OPTIMIZER_H
+
+#include "ast.h"
+#include "../core/string.h"
+#include "../core/dynamic_array.h"
+
+namespace Tick {
+
+class Optimizer {
+public:
+    Optimizer();
+    void optimize(Program* program);
+
+private:
+    struct ConstBinding {
+        String name;
+        ExprNode* value;
+    };
+
+    Program* _program;
+    DynamicArray<ConstBinding> _consts;
+
+    ExprNode* fold_expr(ExprNode* expr);
+    StmtNode* fold_stmt(StmtNode* stmt);
+    void fold_block(BlockStmt* block);
+    ExprNode* fold_binary(BinaryExpr* bin);
+    ExprNode* fold_unary(UnaryExpr* unary);
+    ExprNode* lookup_const(const String& name);
+    void bind_const(VarDecl* decl);
+    void shadow_parameters(FunctionDecl* func);
+    bool literal_matches_type(ExprNode* literal, const String& type_name);
+    static bool terminates_block(StmtNode* stmt);
+
+    void prune_dead_functions(Program* program);
+    void mark_used_stmt(StmtNode* stmt);
+    void mark_used_expr(ExprNode* expr);
+    DynamicArray<FunctionDecl*> _work_queue;
+    DynamicArray<String> _used_functions;
+    bool is_function_used(const String& name);
+};
+
+}
+
+#endif
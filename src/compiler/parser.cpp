@@ -1,11 +1,12 @@
 #include "parser.h"
+#include "interner.h"
 #include <cstdio>
 #include <cstdlib>
 
 namespace Tick {
 
 Parser::Parser(const DynamicArray<Token>& tokens) 
-    : _tokens(tokens), _current(0) {}
+    : _tokens(tokens), _current(0), _arena(nullptr) {}
 
 Token Parser::current_token() {
     return _tokens[_current];
@@ -76,17 +77,18 @@ Token Parser::parse_type() {
         pos += snprintf(buf + pos, sizeof(buf) - pos, "func(");
         if (!check(TokenType::RPAREN)) {
             Token pt = parse_type();
-            pos += snprintf(buf + pos, sizeof(buf) - pos, "%s", pt.lexeme.c_str());
+            pos += snprintf(buf + pos, sizeof(buf) - pos, "%s", pt.lexeme);
             while (match(TokenType::COMMA)) {
                 pt = parse_type();
-                pos += snprintf(buf + pos, sizeof(buf) - pos, ",%s", pt.lexeme.c_str());
+                pos += snprintf(buf + pos, sizeof(buf) - pos, ",%s", pt.lexeme);
             }
         }
         consume(TokenType::RPAREN, "Expected ')' after function pointer params");
         consume(TokenType::COLON, "Expected ':' after function pointer params");
         Token ret = parse_type();
-        pos += snprintf(buf + pos, sizeof(buf) - pos, "):%s", ret.lexeme.c_str());
-        type_token.lexeme = String(buf);
+        pos += snprintf(buf + pos, sizeof(buf) - pos, "):%s", ret.lexeme);
+        type_token.lexeme = StringInterner::intern(buf);
+        type_token.length = pos;
         return type_token;
     }
     if (type == TokenType::U8 || type == TokenType::U16 ||
@@ -105,8 +107,9 @@ Token Parser::parse_type() {
             Token inner = parse_type();
             consume(TokenType::GT, "Expected '>' after ptr<type");
             char buf[256];
-            snprintf(buf, sizeof(buf), "ptr<%s>", inner.lexeme.c_str());
-            type_token.lexeme = String(buf);
+            snprintf(buf, sizeof(buf), "ptr<%s>", inner.lexeme);
+            type_token.lexeme = StringInterner::intern(buf);
+            type_token.length = (int)strlen(type_token.lexeme);
             return type_token;
         }
         
@@ -116,25 +119,27 @@ Token Parser::parse_type() {
                 Token size_tok = current_token();
                 advance();
                 consume(TokenType::RBRACKET, "Expected ']' after array size");
-                size_t base_len = type_token.lexeme.length();
-                size_t size_len = size_tok.lexeme.length();
+                size_t base_len = (size_t)type_token.length;
+                size_t size_len = (size_t)size_tok.length;
                 char* array_type = (char*)malloc(base_len + size_len + 3);
-                memcpy(array_type, type_token.lexeme.c_str(), base_len);
+                memcpy(array_type, type_token.lexeme, base_len);
                 array_type[base_len] = '[';
-                memcpy(array_type + base_len + 1, size_tok.lexeme.c_str(), size_len);
+                memcpy(array_type + base_len + 1, size_tok.lexeme, size_len);
                 array_type[base_len + 1 + size_len] = ']';
                 array_type[base_len + 2 + size_len] = '\0';
-                type_token.lexeme = String(array_type);
+                type_token.lexeme = StringInterner::intern(array_type);
+                type_token.length = (int)(base_len + size_len + 2);
                 free(array_type);
             } else {
                 consume(TokenType::RBRACKET, "Expected ']' after '['");
-                size_t base_len = type_token.lexeme.length();
+                size_t base_len = (size_t)type_token.length;
                 char* array_type = (char*)malloc(base_len + 3);
-                memcpy(array_type, type_token.lexeme.c_str(), base_len);
+                memcpy(array_type, type_token.lexeme, base_len);
                 array_type[base_len] = '[';
                 array_type[base_len + 1] = ']';
                 array_type[base_len + 2] = '\0';
-                type_token.lexeme = String(array_type);
+                type_token.lexeme = StringInterner::intern(array_type);
+                type_token.length = (int)(base_len + 2);
                 free(array_type);
             }
         }
@@ -148,6 +153,7 @@ Token Parser::parse_type() {
 
 Program* Parser::parse() {
     Program* program = new Program();
+    _arena = &program->arena;
     
     while (!check(TokenType::END_OF_FILE)) {
         if (!parse_top_level_decl(program)) {
@@ -166,7 +172,7 @@ ImportDecl* Parser::parse_import_decl() {
         Token module = consume(TokenType::IDENTIFIER, "Expected module name");
         consume(TokenType::IMPORT, "Expected 'import'");
         
-        ImportDecl* import_decl = new ImportDecl(module.lexeme);
+        ImportDecl* import_decl = _arena->make<ImportDecl>(module.lexeme);
         import_decl->line = ln;
         import_decl->import_all = false;
         
@@ -191,7 +197,7 @@ ImportDecl* Parser::parse_import_decl() {
         Token module = consume(TokenType::IDENTIFIER, "Expected module name");
         consume(TokenType::SEMICOLON, "Expected ';' after import");
         
-        ImportDecl* decl = new ImportDecl(module.lexeme);
+        ImportDecl* decl = _arena->make<ImportDecl>(module.lexeme);
         decl->line = ln;
         return decl;
     }
@@ -203,7 +209,7 @@ EventDecl* Parser::parse_event_decl() {
     Token name = consume(TokenType::IDENTIFIER, "Expected event name");
     consume(TokenType::SEMICOLON, "Expected ';' after event declaration");
     
-    EventDecl* decl = new EventDecl(name.lexeme);
+    EventDecl* decl = _arena->make<EventDecl>(name.lexeme);
     decl->line = ln;
     return decl;
 }
@@ -218,7 +224,7 @@ SignalDecl* Parser::parse_signal_decl() {
         advance();
         if (!check(TokenType::RBRACKET)) {
             Token size_token = consume(TokenType::INTEGER, "Expected array size");
-            array_size = atoi(size_token.lexeme.c_str());
+            array_size = atoi(size_token.lexeme);
         }
         consume(TokenType::RBRACKET, "Expected ']'");
     }
@@ -227,7 +233,7 @@ SignalDecl* Parser::parse_signal_decl() {
     Token type = parse_type();
     consume(TokenType::SEMICOLON, "Expected ';' after signal declaration");
     
-    SignalDecl* decl = new SignalDecl(type.lexeme, name.lexeme, array_size);
+    SignalDecl* decl = _arena->make<SignalDecl>(type.lexeme, name.lexeme, array_size);
     decl->line = ln;
     return decl;
 }
@@ -240,7 +246,7 @@ ProcessDecl* Parser::parse_process_decl() {
     Token name = consume(TokenType::IDENTIFIER, "Expected process name");
     BlockStmt* body = parse_block();
     
-    ProcessDecl* decl = new ProcessDecl(event_name.lexeme, name.lexeme, body);
+    ProcessDecl* decl = _arena->make<ProcessDecl>(event_name.lexeme, name.lexeme, body);
     decl->line = ln;
     return decl;
 }
@@ -267,7 +273,7 @@ void Parser::parse_class_decl(Program* program, bool is_dataclass) {
     
     consume(TokenType::LBRACE, "Expected '{' after class declaration");
     
-    ClassDecl* cls = new ClassDecl(name.lexeme);
+    ClassDecl* cls = _arena->make<ClassDecl>(name.lexeme);
     cls->line = ln;
     cls->base_class = base_class;
     cls->is_dataclass = is_dataclass;
@@ -288,7 +294,7 @@ void Parser::parse_class_decl(Program* program, bool is_dataclass) {
                 initializer = parse_expression();
             }
             consume(TokenType::SEMICOLON, "Expected ';' after field declaration");
-            VarDecl* field = new VarDecl(type.lexeme, field_name.lexeme, initializer);
+            VarDecl* field = _arena->make<VarDecl>(type.lexeme, field_name.lexeme, initializer);
             field->line = fln;
             cls->fields.push(field);
         } else if (!is_dataclass && check(TokenType::FUNC)) {
@@ -303,7 +309,7 @@ void Parser::parse_class_decl(Program* program, bool is_dataclass) {
             Token method_name = consume(TokenType::IDENTIFIER, "Expected method name after 'func'");
             consume(TokenType::LPAREN, "Expected '(' after method name");
             
-            FunctionDecl* method = new FunctionDecl("", method_name.lexeme, nullptr);
+            FunctionDecl* method = _arena->make<FunctionDecl>("", method_name.lexeme, nullptr);
             method->line = mln;
             method->class_name = name.lexeme;
             method->is_destructor = is_dtor;
@@ -313,7 +319,7 @@ void Parser::parse_class_decl(Program* program, bool is_dataclass) {
                     Token param_name = consume(TokenType::IDENTIFIER, "Expected parameter name");
                     consume(TokenType::COLON, "Expected ':' after parameter name");
                     Token param_type = parse_type();
-                    method->parameters.push(new Parameter(param_type.lexeme, param_name.lexeme));
+                    method->parameters.push(_arena->make<Parameter>(param_type.lexeme, param_name.lexeme));
                 } while (match(TokenType::COMMA));
             }
             
@@ -340,7 +346,7 @@ FunctionDecl* Parser::parse_function_decl() {
     Token name = consume(TokenType::IDENTIFIER, "Expected function name after 'func'");
     consume(TokenType::LPAREN, "Expected '(' after function name");
     
-    FunctionDecl* func = new FunctionDecl("", name.lexeme, nullptr);
+    FunctionDecl* func = _arena->make<FunctionDecl>("", name.lexeme, nullptr);
     func->line = ln;
     
     if (!check(TokenType::RPAREN)) {
@@ -349,7 +355,7 @@ FunctionDecl* Parser::parse_function_decl() {
             consume(TokenType::COLON, "Expected ':' after parameter name");
             Token param_type = parse_type();
             
-            func->parameters.push(new Parameter(param_type.lexeme, param_name.lexeme));
+            func->parameters.push(_arena->make<Parameter>(param_type.lexeme, param_name.lexeme));
         } while (match(TokenType::COMMA));
     }
     
@@ -366,7 +372,7 @@ FunctionDecl* Parser::parse_function_decl() {
 BlockStmt* Parser::parse_block() {
     consume(TokenType::LBRACE, "Expected '{'");
     
-    BlockStmt* block = new BlockStmt();
+    BlockStmt* block = _arena->make<BlockStmt>();
     block->line = current_token().line;
     
     while (!check(TokenType::RBRACE) && !check(TokenType::END_OF_FILE)) {
@@ -440,7 +446,7 @@ StmtNode* Parser::parse_var_decl() {
     }
     
     consume(TokenType::SEMICOLON, "Expected ';' after variable declaration");
-    VarDecl* decl = new VarDecl(type.lexeme, name.lexeme, initializer, is_const);
+    VarDecl* decl = _arena->make<VarDecl>(type.lexeme, name.lexeme, initializer, is_const);
     decl->line = ln;
     return decl;
 }
@@ -459,7 +465,7 @@ StmtNode* Parser::parse_if_stmt() {
         else_branch = parse_statement();
     }
     
-    IfStmt* stmt = new IfStmt(condition, then_branch, else_branch);
+    IfStmt* stmt = _arena->make<IfStmt>(condition, then_branch, else_branch);
     stmt->line = ln;
     return stmt;
 }
@@ -472,7 +478,7 @@ StmtNode* Parser::parse_while_stmt() {
     consume(TokenType::RPAREN, "Expected ')' after condition");
     StmtNode* body = parse_statement();
     
-    WhileStmt* stmt = new WhileStmt(condition, body);
+    WhileStmt* stmt = _arena->make<WhileStmt>(condition, body);
     stmt->line = ln;
     return stmt;
 }
@@ -505,7 +511,7 @@ StmtNode* Parser::parse_for_stmt() {
     
     StmtNode* body = parse_statement();
     
-    ForStmt* stmt = new ForStmt(initializer, condition, increment, body);
+    ForStmt* stmt = _arena->make<ForStmt>(initializer, condition, increment, body);
     stmt->line = ln;
     return stmt;
 }
@@ -520,7 +526,7 @@ StmtNode* Parser::parse_return_stmt() {
     }
     
     consume(TokenType::SEMICOLON, "Expected ';' after return statement");
-    ReturnStmt* stmt = new ReturnStmt(value);
+    ReturnStmt* stmt = _arena->make<ReturnStmt>(value);
     stmt->line = ln;
     return stmt;
 }
@@ -529,7 +535,7 @@ StmtNode* Parser::parse_break_stmt() {
     int ln = current_token().line;
     consume(TokenType::BREAK, "Expected 'break'");
     consume(TokenType::SEMICOLON, "Expected ';' after break statement");
-    BreakStmt* stmt = new BreakStmt();
+    BreakStmt* stmt = _arena->make<BreakStmt>();
     stmt->line = ln;
     return stmt;
 }
@@ -538,7 +544,7 @@ StmtNode* Parser::parse_continue_stmt() {
     int ln = current_token().line;
     consume(TokenType::CONTINUE, "Expected 'continue'");
     consume(TokenType::SEMICOLON, "Expected ';' after continue statement");
-    ContinueStmt* stmt = new ContinueStmt();
+    ContinueStmt* stmt = _arena->make<ContinueStmt>();
     stmt->line = ln;
     return stmt;
 }
@@ -547,7 +553,7 @@ StmtNode* Parser::parse_defer_stmt() {
     int ln = current_token().line;
     consume(TokenType::DEFER, "Expected 'defer'");
     StmtNode* stmt = parse_statement();
-    DeferStmt* defer = new DeferStmt(stmt);
+    DeferStmt* defer = _arena->make<DeferStmt>(stmt);
     defer->line = ln;
     return defer;
 }
@@ -560,11 +566,11 @@ StmtNode* Parser::parse_switch_stmt() {
     consume(TokenType::RPAREN, "Expected ')' after switch expression");
     consume(TokenType::LBRACE, "Expected '{' after switch");
 
-    SwitchStmt* sw = new SwitchStmt(subject);
+    SwitchStmt* sw = _arena->make<SwitchStmt>(subject);
     sw->line = ln;
 
     while (!check(TokenType::RBRACE) && !check(TokenType::END_OF_FILE)) {
-        SwitchCase* sc = new SwitchCase();
+        SwitchCase* sc = _arena->make<SwitchCase>();
         if (check(TokenType::CASE)) {
             advance();
             sc->values.push(parse_expression());
@@ -576,7 +582,7 @@ StmtNode* Parser::parse_switch_stmt() {
                 consume(TokenType::COLON, "Expected ':' after case value");
             }
 
-            BlockStmt* body = new BlockStmt();
+            BlockStmt* body = _arena->make<BlockStmt>();
             body->line = current_token().line;
             while (!check(TokenType::CASE) && !check(TokenType::DEFAULT) &&
                    !check(TokenType::RBRACE) && !check(TokenType::END_OF_FILE)) {
@@ -588,7 +594,7 @@ StmtNode* Parser::parse_switch_stmt() {
             consume(TokenType::COLON, "Expected ':' after 'default'");
             sc->is_default = true;
 
-            BlockStmt* body = new BlockStmt();
+            BlockStmt* body = _arena->make<BlockStmt>();
             body->line = current_token().line;
             while (!check(TokenType::CASE) && !check(TokenType::DEFAULT) &&
                    !check(TokenType::RBRACE) && !check(TokenType::END_OF_FILE)) {
@@ -596,7 +602,6 @@ StmtNode* Parser::parse_switch_stmt() {
             }
             sc->body = body;
         } else {
-            delete sc;
             fprintf(stderr, "Parse error at line %d: Expected 'case' or 'default' in switch\n", current_token().line);
             exit(1);
         }
@@ -613,7 +618,7 @@ EnumDecl* Parser::parse_enum_decl() {
     Token name = consume(TokenType::IDENTIFIER, "Expected enum name");
     consume(TokenType::LBRACE, "Expected '{' after enum name");
 
-    EnumDecl* decl = new EnumDecl(name.lexeme);
+    EnumDecl* decl = _arena->make<EnumDecl>(name.lexeme);
     decl->line = ln;
 
     while (!check(TokenType::RBRACE) && !check(TokenType::END_OF_FILE)) {
@@ -621,12 +626,12 @@ EnumDecl* Parser::parse_enum_decl() {
         if (match(TokenType::ASSIGN)) {
             Token val = consume(TokenType::INTEGER, "Expected integer value");
             int v = 0;
-            for (size_t i = 0; i < val.lexeme.length(); i++) {
+            for (size_t i = 0; i < (size_t)val.length; i++) {
                 v = v * 10 + (val.lexeme[i] - '0');
             }
-            decl->values.push(new EnumValue(val_name.lexeme, v));
+            decl->values.push(_arena->make<EnumValue>(val_name.lexeme, v));
         } else {
-            decl->values.push(new EnumValue(val_name.lexeme));
+            decl->values.push(_arena->make<EnumValue>(val_name.lexeme));
         }
         if (!check(TokenType::RBRACE)) {
             consume(TokenType::COMMA, "Expected ',' between enum values");
@@ -643,7 +648,7 @@ UnionDecl* Parser::parse_union_decl() {
     Token name = consume(TokenType::IDENTIFIER, "Expected union name");
     consume(TokenType::LBRACE, "Expected '{' after union name");
 
-    UnionDecl* decl = new UnionDecl(name.lexeme);
+    UnionDecl* decl = _arena->make<UnionDecl>(name.lexeme);
     decl->line = ln;
 
     while (!check(TokenType::RBRACE) && !check(TokenType::END_OF_FILE)) {
@@ -651,7 +656,7 @@ UnionDecl* Parser::parse_union_decl() {
         consume(TokenType::COLON, "Expected ':' after field name");
         Token type = parse_type();
         consume(TokenType::SEMICOLON, "Expected ';' after union field");
-        decl->fields.push(new UnionField(type.lexeme, field_name.lexeme));
+        decl->fields.push(_arena->make<UnionField>(type.lexeme, field_name.lexeme));
     }
 
     consume(TokenType::RBRACE, "Expected '}' after union body");
@@ -662,7 +667,7 @@ StmtNode* Parser::parse_expr_stmt() {
     int ln = current_token().line;
     ExprNode* expr = parse_expression();
     consume(TokenType::SEMICOLON, "Expected ';' after expression");
-    ExprStmt* stmt = new ExprStmt(expr);
+    ExprStmt* stmt = _arena->make<ExprStmt>(expr);
     stmt->line = ln;
     return stmt;
 }
@@ -677,77 +682,77 @@ ExprNode* Parser::parse_assignment() {
     
     if (match(TokenType::ASSIGN)) {
         ExprNode* value = parse_assignment();
-        AssignExpr* node = new AssignExpr(expr, value);
+        AssignExpr* node = _arena->make<AssignExpr>(expr, value);
         node->line = ln;
         return node;
     }
     
     if (match(TokenType::PLUS_ASSIGN)) {
         ExprNode* value = parse_assignment();
-        CompoundAssignExpr* node = new CompoundAssignExpr(expr, String("+"), value);
+        CompoundAssignExpr* node = _arena->make<CompoundAssignExpr>(expr, String("+"), value);
         node->line = ln;
         return node;
     }
     
     if (match(TokenType::MINUS_ASSIGN)) {
         ExprNode* value = parse_assignment();
-        CompoundAssignExpr* node = new CompoundAssignExpr(expr, String("-"), value);
+        CompoundAssignExpr* node = _arena->make<CompoundAssignExpr>(expr, String("-"), value);
         node->line = ln;
         return node;
     }
     
     if (match(TokenType::STAR_ASSIGN)) {
         ExprNode* value = parse_assignment();
-        CompoundAssignExpr* node = new CompoundAssignExpr(expr, String("*"), value);
+        CompoundAssignExpr* node = _arena->make<CompoundAssignExpr>(expr, String("*"), value);
         node->line = ln;
         return node;
     }
     
     if (match(TokenType::SLASH_ASSIGN)) {
         ExprNode* value = parse_assignment();
-        CompoundAssignExpr* node = new CompoundAssignExpr(expr, String("/"), value);
+        CompoundAssignExpr* node = _arena->make<CompoundAssignExpr>(expr, String("/"), value);
         node->line = ln;
         return node;
     }
     
     if (match(TokenType::PERCENT_ASSIGN)) {
         ExprNode* value = parse_assignment();
-        CompoundAssignExpr* node = new CompoundAssignExpr(expr, String("%"), value);
+        CompoundAssignExpr* node = _arena->make<CompoundAssignExpr>(expr, String("%"), value);
         node->line = ln;
         return node;
     }
     
     if (match(TokenType::AMPERSAND_ASSIGN)) {
         ExprNode* value = parse_assignment();
-        CompoundAssignExpr* node = new CompoundAssignExpr(expr, String("&"), value);
+        CompoundAssignExpr* node = _arena->make<CompoundAssignExpr>(expr, String("&"), value);
         node->line = ln;
         return node;
     }
     
     if (match(TokenType::PIPE_ASSIGN)) {
         ExprNode* value = parse_assignment();
-        CompoundAssignExpr* node = new CompoundAssignExpr(expr, String("|"), value);
+        CompoundAssignExpr* node = _arena->make<CompoundAssignExpr>(expr, String("|"), value);
         node->line = ln;
         return node;
     }
     
     if (match(TokenType::CARET_ASSIGN)) {
         ExprNode* value = parse_assignment();
-        CompoundAssignExpr* node = new CompoundAssignExpr(expr, String("^"), value);
+        CompoundAssignExpr* node = _arena->make<CompoundAssignExpr>(expr, String("^"), value);
         node->line = ln;
         return node;
     }
     
     if (match(TokenType::LSHIFT_ASSIGN)) {
         ExprNode* value = parse_assignment();
-        CompoundAssignExpr* node = new CompoundAssignExpr(expr, String("<<"), value);
+        CompoundAssignExpr* node = _arena->make<CompoundAssignExpr>(expr, String("<<"), value);
         node->line = ln;
         return node;
     }
     
     if (match(TokenType::RSHIFT_ASSIGN)) {
         ExprNode* value = parse_assignment();
-        CompoundAssignExpr* node = new CompoundAssignExpr(expr, String(">>"), value);
+        CompoundAssignExpr* node = _arena->make<CompoundAssignExpr>(expr, String(">>"), value);
         node->line = ln;
         return node;
     }
@@ -762,7 +767,7 @@ ExprNode* Parser::parse_logical_or() {
         int ln = _tokens[_current - 1].line;
         String op("||");
         ExprNode* right = parse_logical_and();
-        BinaryExpr* node = new BinaryExpr(expr, op, right);
+        BinaryExpr* node = _arena->make<BinaryExpr>(expr, op, right);
         node->line = ln;
         expr = node;
     }
@@ -777,7 +782,7 @@ ExprNode* Parser::parse_logical_and() {
         int ln = _tokens[_current - 1].line;
         String op("&&");
         ExprNode* right = parse_bitwise_or();
-        BinaryExpr* node = new BinaryExpr(expr, op, right);
+        BinaryExpr* node = _arena->make<BinaryExpr>(expr, op, right);
         node->line = ln;
         expr = node;
     }
@@ -792,7 +797,7 @@ ExprNode* Parser::parse_equality() {
         int ln = _tokens[_current - 1].line;
         String op = _tokens[_current - 1].lexeme;
         ExprNode* right = parse_comparison();
-        BinaryExpr* node = new BinaryExpr(expr, op, right);
+        BinaryExpr* node = _arena->make<BinaryExpr>(expr, op, right);
         node->line = ln;
         expr = node;
     }
@@ -808,7 +813,7 @@ ExprNode* Parser::parse_comparison() {
         int ln = _tokens[_current - 1].line;
         String op = _tokens[_current - 1].lexeme;
         ExprNode* right = parse_shift();
-        BinaryExpr* node = new BinaryExpr(expr, op, right);
+        BinaryExpr* node = _arena->make<BinaryExpr>(expr, op, right);
         node->line = ln;
         expr = node;
     }
@@ -823,7 +828,7 @@ ExprNode* Parser::parse_term() {
         int ln = _tokens[_current - 1].line;
         String op = _tokens[_current - 1].lexeme;
         ExprNode* right = parse_factor();
-        BinaryExpr* node = new BinaryExpr(expr, op, right);
+        BinaryExpr* node = _arena->make<BinaryExpr>(expr, op, right);
         node->line = ln;
         expr = node;
     }
@@ -838,7 +843,7 @@ ExprNode* Parser::parse_factor() {
         int ln = _tokens[_current - 1].line;
         String op = _tokens[_current - 1].lexeme;
         ExprNode* right = parse_unary();
-        BinaryExpr* node = new BinaryExpr(expr, op, right);
+        BinaryExpr* node = _arena->make<BinaryExpr>(expr, op, right);
         node->line = ln;
         expr = node;
     }
@@ -851,7 +856,7 @@ ExprNode* Parser::parse_unary() {
         int ln = _tokens[_current - 1].line;
         String op = _tokens[_current - 1].lexeme;
         ExprNode* operand = parse_unary();
-        UnaryExpr* node = new UnaryExpr(op, operand);
+        UnaryExpr* node = _arena->make<UnaryExpr>(op, operand);
         node->line = ln;
         return node;
     }
@@ -859,7 +864,7 @@ ExprNode* Parser::parse_unary() {
     if (match(TokenType::INCREMENT)) {
         int ln = _tokens[_current - 1].line;
         ExprNode* operand = parse_unary();
-        UnaryExpr* node = new UnaryExpr(String("++"), operand);
+        UnaryExpr* node = _arena->make<UnaryExpr>(String("++"), operand);
         node->line = ln;
         return node;
     }
@@ -867,7 +872,7 @@ ExprNode* Parser::parse_unary() {
     if (match(TokenType::DECREMENT)) {
         int ln = _tokens[_current - 1].line;
         ExprNode* operand = parse_unary();
-        UnaryExpr* node = new UnaryExpr(String("--"), operand);
+        UnaryExpr* node = _arena->make<UnaryExpr>(String("--"), operand);
         node->line = ln;
         return node;
     }
@@ -882,7 +887,7 @@ ExprNode* Parser::parse_postfix() {
         if (match(TokenType::DOT)) {
             int ln = _tokens[_current - 1].line;
             Token member = consume(TokenType::IDENTIFIER, "Expected member name");
-            MemberExpr* node = new MemberExpr(expr, member.lexeme);
+            MemberExpr* node = _arena->make<MemberExpr>(expr, member.lexeme);
             node->line = ln;
             expr = node;
         } else if (check(TokenType::LBRACKET)) {
@@ -890,12 +895,12 @@ ExprNode* Parser::parse_postfix() {
             advance();
             ExprNode* index = parse_expression();
             consume(TokenType::RBRACKET, "Expected ']' after index");
-            IndexExpr* node = new IndexExpr(expr, index);
+            IndexExpr* node = _arena->make<IndexExpr>(expr, index);
             node->line = ln;
             expr = node;
         } else if (match(TokenType::LPAREN)) {
             int ln = _tokens[_current - 1].line;
-            CallExpr* call = new CallExpr(expr);
+            CallExpr* call = _arena->make<CallExpr>(expr);
             call->line = ln;
             if (!check(TokenType::RPAREN)) {
                 do {
@@ -907,13 +912,13 @@ ExprNode* Parser::parse_postfix() {
         } else if (check(TokenType::INCREMENT)) {
             int ln = current_token().line;
             advance();
-            PostfixExpr* node = new PostfixExpr(expr, String("++"));
+            PostfixExpr* node = _arena->make<PostfixExpr>(expr, String("++"));
             node->line = ln;
             expr = node;
         } else if (check(TokenType::DECREMENT)) {
             int ln = current_token().line;
             advance();
-            PostfixExpr* node = new PostfixExpr(expr, String("--"));
+            PostfixExpr* node = _arena->make<PostfixExpr>(expr, String("--"));
             node->line = ln;
             expr = node;
         } else {
@@ -928,17 +933,17 @@ ExprNode* Parser::parse_primary() {
     int ln = current_token().line;
     
     if (match(TokenType::TRUE)) {
-        BoolLiteral* node = new BoolLiteral(true);
+        BoolLiteral* node = _arena->make<BoolLiteral>(true);
         node->line = ln;
         return node;
     }
     if (match(TokenType::FALSE)) {
-        BoolLiteral* node = new BoolLiteral(false);
+        BoolLiteral* node = _arena->make<BoolLiteral>(false);
         node->line = ln;
         return node;
     }
     if (match(TokenType::NULL_LIT)) {
-        NullLiteral* node = new NullLiteral();
+        NullLiteral* node = _arena->make<NullLiteral>();
         node->line = ln;
         return node;
     }
@@ -948,7 +953,7 @@ ExprNode* Parser::parse_primary() {
         consume(TokenType::COMMA, "Expected ',' after cast expression");
         Token target = parse_type();
         consume(TokenType::RPAREN, "Expected ')' after cast type");
-        CastExpr* node = new CastExpr(expr, target.lexeme);
+        CastExpr* node = _arena->make<CastExpr>(expr, target.lexeme);
         node->line = ln;
         return node;
     }
@@ -956,17 +961,17 @@ ExprNode* Parser::parse_primary() {
         consume(TokenType::LPAREN, "Expected '(' after 'sizeof'");
         Token target = parse_type();
         consume(TokenType::RPAREN, "Expected ')' after sizeof type");
-        SizeofExpr* node = new SizeofExpr(target.lexeme);
+        SizeofExpr* node = _arena->make<SizeofExpr>(target.lexeme);
         node->line = ln;
         return node;
     }
     if (match(TokenType::INTEGER)) {
         Token token = _tokens[_current - 1];
         int value = 0;
-        for (size_t i = 0; i < token.lexeme.length(); i++) {
+        for (size_t i = 0; i < (size_t)token.length; i++) {
             value = value * 10 + (token.lexeme[i] - '0');
         }
-        IntegerLiteral* node = new IntegerLiteral(value);
+        IntegerLiteral* node = _arena->make<IntegerLiteral>(value);
         node->line = ln;
         return node;
     }
@@ -977,7 +982,7 @@ ExprNode* Parser::parse_primary() {
         int decimal_places = 0;
         bool is_decimal = false;
         
-        for (size_t i = 0; i < token.lexeme.length(); i++) {
+        for (size_t i = 0; i < (size_t)token.length; i++) {
             if (token.lexeme[i] == '.') {
                 is_decimal = true;
                 continue;
@@ -997,7 +1002,7 @@ ExprNode* Parser::parse_primary() {
         }
         value += decimal;
         
-        FloatLiteral* node = new FloatLiteral(value);
+        FloatLiteral* node = _arena->make<FloatLiteral>(value);
         node->line = ln;
         return node;
     }
@@ -1008,7 +1013,7 @@ ExprNode* Parser::parse_primary() {
         int decimal_places = 0;
         bool is_decimal = false;
         
-        for (size_t i = 0; i < token.lexeme.length(); i++) {
+        for (size_t i = 0; i < (size_t)token.length; i++) {
             if (token.lexeme[i] == '.') {
                 is_decimal = true;
                 continue;
@@ -1027,16 +1032,16 @@ ExprNode* Parser::parse_primary() {
         }
         value += decimal;
         
-        DoubleLiteral* node = new DoubleLiteral(value);
+        DoubleLiteral* node = _arena->make<DoubleLiteral>(value);
         node->line = ln;
         return node;
     }
     if (match(TokenType::STRING)) {
         Token token = _tokens[_current - 1];
-        char* str_val = (char*)malloc(token.lexeme.length() + 1);
+        char* str_val = (char*)malloc((size_t)token.length + 1);
         size_t j = 0;
-        for (size_t i = 0; i < token.lexeme.length(); i++) {
-            if (token.lexeme[i] == '\\' && i + 1 < token.lexeme.length()) {
+        for (size_t i = 0; i < (size_t)token.length; i++) {
+            if (token.lexeme[i] == '\\' && i + 1 < (size_t)token.length) {
                 i++;
                 if (token.lexeme[i] == 'n') str_val[j++] = '\n';
                 else if (token.lexeme[i] == 't') str_val[j++] = '\t';
@@ -1050,17 +1055,17 @@ ExprNode* Parser::parse_primary() {
         str_val[j] = '\0';
         String result(str_val);
         free(str_val);
-        StringLiteral* node = new StringLiteral(result);
+        StringLiteral* node = _arena->make<StringLiteral>(result);
         node->line = ln;
         return node;
     }
     if (match(TokenType::IDENTIFIER)) {
-        IdentifierExpr* node = new IdentifierExpr(_tokens[_current - 1].lexeme);
+        IdentifierExpr* node = _arena->make<IdentifierExpr>(_tokens[_current - 1].lexeme);
         node->line = ln;
         return node;
     }
     if (match(TokenType::THIS)) {
-        ThisExpr* node = new ThisExpr();
+        ThisExpr* node = _arena->make<ThisExpr>();
         node->line = ln;
         return node;
     }
@@ -1070,7 +1075,7 @@ ExprNode* Parser::parse_primary() {
         return expr;
     }
     if (match(TokenType::LBRACKET)) {
-        ArrayExpr* array = new ArrayExpr();
+        ArrayExpr* array = _arena->make<ArrayExpr>();
         array->line = ln;
         
         if (!check(TokenType::RBRACKET)) {
@@ -1093,7 +1098,7 @@ ExprNode* Parser::parse_bitwise_or() {
     while (match(TokenType::PIPE)) {
         int ln = _tokens[_current - 1].line;
         ExprNode* right = parse_bitwise_xor();
-        BinaryExpr* node = new BinaryExpr(expr, String("|"), right);
+        BinaryExpr* node = _arena->make<BinaryExpr>(expr, String("|"), right);
         node->line = ln;
         expr = node;
     }
@@ -1107,7 +1112,7 @@ ExprNode* Parser::parse_bitwise_xor() {
     while (match(TokenType::CARET)) {
         int ln = _tokens[_current - 1].line;
         ExprNode* right = parse_bitwise_and();
-        BinaryExpr* node = new BinaryExpr(expr, String("^"), right);
+        BinaryExpr* node = _arena->make<BinaryExpr>(expr, String("^"), right);
         node->line = ln;
         expr = node;
     }
@@ -1121,7 +1126,7 @@ ExprNode* Parser::parse_bitwise_and() {
     while (match(TokenType::AMPERSAND)) {
         int ln = _tokens[_current - 1].line;
         ExprNode* right = parse_equality();
-        BinaryExpr* node = new BinaryExpr(expr, String("&"), right);
+        BinaryExpr* node = _arena->make<BinaryExpr>(expr, String("&"), right);
         node->line = ln;
         expr = node;
     }
@@ -1136,7 +1141,7 @@ ExprNode* Parser::parse_shift() {
         int ln = _tokens[_current - 1].line;
         String op = _tokens[_current - 1].lexeme;
         ExprNode* right = parse_term();
-        BinaryExpr* node = new BinaryExpr(expr, op, right);
+        BinaryExpr* node = _arena->make<BinaryExpr>(expr, op, right);
         node->line = ln;
         expr = node;
     }
@@ -1151,7 +1156,7 @@ ExternFuncDecl* Parser::parse_extern_func_decl() {
     Token name = consume(TokenType::IDENTIFIER, "Expected function name");
     consume(TokenType::LPAREN, "Expected '(' after function name");
     
-    ExternFuncDecl* decl = new ExternFuncDecl(String(""), name.lexeme);
+    ExternFuncDecl* decl = _arena->make<ExternFuncDecl>(String(""), name.lexeme);
     decl->line = ln;
     
     if (!check(TokenType::RPAREN)) {
@@ -1159,7 +1164,7 @@ ExternFuncDecl* Parser::parse_extern_func_decl() {
             Token param_name = consume(TokenType::IDENTIFIER, "Expected parameter name");
             consume(TokenType::COLON, "Expected ':' after parameter name");
             Token param_type = parse_type();
-            decl->parameters.push(new Parameter(param_type.lexeme, param_name.lexeme));
+            decl->parameters.push(_arena->make<Parameter>(param_type.lexeme, param_name.lexeme));
         } while (match(TokenType::COMMA));
     }
     
@@ -1178,7 +1183,7 @@ void Parser::parse_interface_decl(Program* program) {
     Token name = consume(TokenType::IDENTIFIER, "Expected interface name");
     consume(TokenType::LBRACE, "Expected '{' after interface name");
     
-    InterfaceDecl* iface = new InterfaceDecl(name.lexeme);
+    InterfaceDecl* iface = _arena->make<InterfaceDecl>(name.lexeme);
     iface->line = ln;
     
     while (!check(TokenType::RBRACE) && !check(TokenType::END_OF_FILE)) {
@@ -1186,14 +1191,14 @@ void Parser::parse_interface_decl(Program* program) {
         Token method_name = consume(TokenType::IDENTIFIER, "Expected method name");
         consume(TokenType::LPAREN, "Expected '(' after method name");
         
-        InterfaceMethod* method = new InterfaceMethod(method_name.lexeme, String(""));
+        InterfaceMethod* method = _arena->make<InterfaceMethod>(method_name.lexeme, String(""));
         
         if (!check(TokenType::RPAREN)) {
             do {
                 Token param_name = consume(TokenType::IDENTIFIER, "Expected parameter name");
                 consume(TokenType::COLON, "Expected ':' after parameter name");
                 Token param_type = parse_type();
-                method->parameters.push(new Parameter(param_type.lexeme, param_name.lexeme));
+                method->parameters.push(_arena->make<Parameter>(param_type.lexeme, param_name.lexeme));
             } while (match(TokenType::COMMA));
         }
         
@@ -1223,7 +1228,7 @@ StmtNode* Parser::parse_try_catch_stmt() {
     consume(TokenType::RPAREN, "Expected ')' after catch type");
     BlockStmt* catch_body = parse_block();
     
-    TryCatchStmt* stmt = new TryCatchStmt(try_body, catch_var.lexeme, catch_type.lexeme, catch_body);
+    TryCatchStmt* stmt = _arena->make<TryCatchStmt>(try_body, catch_var.lexeme, catch_type.lexeme, catch_body);
     stmt->line = ln;
     return stmt;
 }
@@ -1233,7 +1238,7 @@ StmtNode* Parser::parse_throw_stmt() {
     consume(TokenType::THROW, "Expected 'throw'");
     ExprNode* value = parse_expression();
     consume(TokenType::SEMICOLON, "Expected ';' after throw expression");
-    ThrowStmt* stmt = new ThrowStmt(value);
+    ThrowStmt* stmt = _arena->make<ThrowStmt>(value);
     stmt->line = ln;
     return stmt;
 }
@@ -1295,7 +1300,7 @@ bool Parser::parse_top_level_decl(Program* program) {
         advance();
         Token flag = consume(TokenType::STRING, "Expected string after 'link'");
         consume(TokenType::SEMICOLON, "Expected ';' after link directive");
-        program->link_flags.push(flag.lexeme);
+        program->link_flags.push(String(flag.lexeme, flag.length));
     } else {
         return false;
     }
@@ -1310,7 +1315,7 @@ void Parser::parse_conditional_compile(Program* program) {
     consume(TokenType::RPAREN, "Expected ')' after define name");
     consume(TokenType::LBRACE, "Expected '{' after '@if(...)'");
 
-    bool active = has_define(define_name.lexeme.c_str());
+    bool active = has_define(define_name.lexeme);
 
     if (active) {
         while (!check(TokenType::RBRACE) && !check(TokenType::END_OF_FILE)) {
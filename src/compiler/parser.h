@@ -18,6 +18,7 @@ private:
     const DynamicArray<Token>& _tokens;
     size_t _current;
     DynamicArray<String> _defines;
+    Arena* _arena;
     
     Token current_token();
     Token peek_token(int offset = 1);
@@ -1,6 +1,8 @@
 #include "semantic_analyzer.h"
 #include <cstdio>
 #include <cstring>
+#include <pthread.h>
+#include <unistd.h>
 
 namespace Tick {
 
@@ -176,8 +178,11 @@ bool SemanticAnalyzer::is_builtin_function(const String& name) {
            name == "str_compare" || name == "to_str" ||
            name == "parse" || name == "str_char_at" ||
            name == "file_open" || name == "file_read" ||
+           name == "file_read_line" || name == "file_read_chunk" ||
+           name == "file_mmap" ||
            name == "file_write" || name == "file_close" ||
-           name == "file_exists" ||
+           name == "file_exists" || name == "file_read_async" ||
+           name == "file_write_async" ||
            name == "free" || name == "array_length" ||
            name == "addr" || name == "sizeof" || name == "deref" ||
            name == "malloc" || name == "memset" || name == "memcpy" ||
@@ -266,12 +271,17 @@ String SemanticAnalyzer::infer_type(ExprNode* node) {
                 }
                 if (id->name == "str_concat" || id->name == "str_substring" ||
                     id->name == "to_str" ||
-                    id->name == "file_read" || id->name == "input") {
+                    id->name == "file_read" || id->name == "file_read_line" ||
+                    id->name == "file_read_chunk" || id->name == "file_mmap" ||
+                    id->name == "input") {
                     return String("str");
                 }
                 if (id->name == "parse") return String("");
                 if (id->name == "str_char_at") return String("u8");
                 if (id->name == "file_exists") return String("b8");
+                if (id->name == "file_read_async" || id->name == "file_write_async") {
+                    return String("void");
+                }
                 if (id->name == "addr") {
                     if (call->arguments.size() > 0) {
                         String arg_type = infer_type(call->arguments[0]);
@@ -319,17 +329,24 @@ String SemanticAnalyzer::infer_type(ExprNode* node) {
             if (call->callee->type == AstNodeType::MEMBER_EXPR) {
                 MemberExpr* me = static_cast<MemberExpr*>(call->callee);
                 if (me->member == "length") return String("i32");
-                if (me->member == "push") return String("void");
+                if (me->member == "push" || me->member == "reserve" ||
+                    me->member == "append") return String("void");
                 if (me->member == "pop") {
                     String arr_type = infer_type(me->object);
                     if (is_array_type(arr_type)) return array_base_type(arr_type);
                 }
-                if (me->member == "recv") {
+                if (me->member == "emit_n") return String("void");
+                if (me->member == "recv" || me->member == "recv_n") {
+                    bool batched = me->member == "recv_n";
                     if (_program && me->object->type == AstNodeType::IDENTIFIER_EXPR) {
                         IdentifierExpr* sig_id = static_cast<IdentifierExpr*>(me->object);
                         for (size_t i = 0; i < _program->signals.size(); i++) {
                             if (_program->signals[i]->name == sig_id->name) {
-                                return _program->signals[i]->type_param;
+                                if (!batched) return _program->signals[i]->type_param;
+                                char arr_type[140];
+                                snprintf(arr_type, sizeof(arr_type), "%s[]",
+                                    _program->signals[i]->type_param.c_str());
+                                return String(arr_type);
                             }
                         }
                     }
@@ -339,12 +356,16 @@ String SemanticAnalyzer::infer_type(ExprNode* node) {
                             IdentifierExpr* sig_id = static_cast<IdentifierExpr*>(idx->array);
                             for (size_t i = 0; i < _program->signals.size(); i++) {
                                 if (_program->signals[i]->name == sig_id->name) {
-                                    return _program->signals[i]->type_param;
+                                    if (!batched) return _program->signals[i]->type_param;
+                                    char arr_type[140];
+                                    snprintf(arr_type, sizeof(arr_type), "%s[]",
+                                        _program->signals[i]->type_param.c_str());
+                                    return String(arr_type);
                                 }
                             }
                         }
                     }
-                    return String("i32");
+                    return batched ? String("i32[]") : String("i32");
                 }
                 String obj_type = infer_type(me->object);
                 if (_program) {
@@ -498,17 +519,94 @@ bool SemanticAnalyzer::analyze(Program* program) {
         analyze_class_decl(program->classes[i]);
     }
 
-    for (size_t i = 0; i < program->functions.size(); i++) {
-        analyze_function_decl(program->functions[i]);
-    }
-
     for (size_t i = 0; i < program->processes.size(); i++) {
         analyze_process_decl(program->processes[i]);
     }
 
+    size_t body_count = program->classes.size() + program->functions.size() +
+                        program->processes.size();
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t worker_count = cores > 1 ? (size_t)cores : 1;
+    if (worker_count > body_count) worker_count = body_count;
+
+    if (worker_count <= 1 || body_count < 16) {
+        for (size_t i = 0; i < program->classes.size(); i++) {
+            analyze_class_bodies(program->classes[i]);
+        }
+        for (size_t i = 0; i < program->functions.size(); i++) {
+            analyze_function_decl(program->functions[i]);
+        }
+        for (size_t i = 0; i < program->processes.size(); i++) {
+            analyze_process_body(program->processes[i]);
+        }
+    } else {
+        analyze_bodies_parallel(program, worker_count);
+    }
+
     return !_has_errors;
 }
 
+struct AnalysisWorker {
+    SemanticAnalyzer* clone;
+    Program* program;
+    size_t index;
+    size_t stride;
+};
+
+void* SemanticAnalyzer::analysis_worker(void* arg) {
+    AnalysisWorker* work = (AnalysisWorker*)arg;
+    Program* program = work->program;
+    size_t class_count = program->classes.size();
+    size_t func_count = program->functions.size();
+    size_t total = class_count + func_count + program->processes.size();
+
+    for (size_t i = work->index; i < total; i += work->stride) {
+        if (i < class_count) {
+            work->clone->analyze_class_bodies(program->classes[i]);
+        } else if (i < class_count + func_count) {
+            work->clone->analyze_function_decl(program->functions[i - class_count]);
+        } else {
+            work->clone->analyze_process_body(program->processes[i - class_count - func_count]);
+        }
+    }
+    return nullptr;
+}
+
+void SemanticAnalyzer::copy_symbols_from(const SemanticAnalyzer& other) {
+    HashMap<const char*, Symbol*>* symbols = &_symbols;
+    other._symbols.for_each([symbols](const char* name, Symbol* const& sym) {
+        symbols->insert(name, new Symbol(*sym));
+    });
+}
+
+void SemanticAnalyzer::analyze_bodies_parallel(Program* program, size_t worker_count) {
+    SemanticAnalyzer* clones = new SemanticAnalyzer[worker_count];
+    AnalysisWorker* work = new AnalysisWorker[worker_count];
+    pthread_t* threads = new pthread_t[worker_count];
+
+    for (size_t i = 0; i < worker_count; i++) {
+        clones[i]._program = program;
+        clones[i]._current_file_path = _current_file_path;
+        clones[i].copy_symbols_from(*this);
+        work[i].clone = &clones[i];
+        work[i].program = program;
+        work[i].index = i;
+        work[i].stride = worker_count;
+        pthread_create(&threads[i], nullptr, analysis_worker, &work[i]);
+    }
+
+    for (size_t i = 0; i < worker_count; i++) {
+        pthread_join(threads[i], nullptr);
+        if (clones[i]._has_errors) {
+            _has_errors = true;
+        }
+    }
+
+    delete[] threads;
+    delete[] work;
+    delete[] clones;
+}
+
 void SemanticAnalyzer::analyze_import_decl(ImportDecl* node, Program* program) {
     if (!_module_loader) {
         error(node->line, "Module loader not set");
@@ -709,7 +807,9 @@ void SemanticAnalyzer::analyze_process_decl(ProcessDecl* node) {
     }
 
     _symbols.insert(node->name.c_str(), new Symbol(SymbolType::PROCESS, node->name, String("process")));
+}
 
+void SemanticAnalyzer::analyze_process_body(ProcessDecl* node) {
     push_scope();
     if (node->body) {
         for (size_t i = 0; i < node->body->statements.size(); i++) {
@@ -789,7 +889,9 @@ void SemanticAnalyzer::analyze_class_decl(ClassDecl* node) {
             error(node->line, msg);
         }
     }
+}
 
+void SemanticAnalyzer::analyze_class_bodies(ClassDecl* node) {
     push_scope();
 
     for (size_t i = 0; i < node->fields.size(); i++) {
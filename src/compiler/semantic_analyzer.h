@@ -65,8 +65,13 @@ private:
     void analyze_event_decl(EventDecl* node);
     void analyze_signal_decl(SignalDecl* node);
     void analyze_process_decl(ProcessDecl* node);
+    void analyze_process_body(ProcessDecl* node);
     void analyze_function_decl(FunctionDecl* node);
     void analyze_class_decl(ClassDecl* node);
+    void analyze_class_bodies(ClassDecl* node);
+    void analyze_bodies_parallel(Program* program, size_t worker_count);
+    void copy_symbols_from(const SemanticAnalyzer& other);
+    static void* analysis_worker(void* arg);
     void analyze_interface_decl(InterfaceDecl* node);
     void analyze_extern_func_decl(ExternFuncDecl* node);
 
@@ -0,0 +1,75 @@
+#include "source_file.h"
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace Tick {
+
+static bool read_fallback(int fd, size_t size, SourceFile* out) {
+    char* buffer = (char*)malloc(size + 1);
+    size_t total = 0;
+    while (total < size) {
+        ssize_t n = read(fd, buffer + total, size - total);
+        if (n <= 0) {
+            free(buffer);
+            return false;
+        }
+        total += n;
+    }
+    buffer[size] = '\0';
+    out->data = buffer;
+    out->size = size;
+    out->mapped = false;
+    return true;
+}
+
+bool SourceLoader::load(const char* path, SourceFile* out) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return false;
+    }
+    size_t size = (size_t)st.st_size;
+
+    size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    if (size == 0 || size % page_size == 0) {
+        bool ok = read_fallback(fd, size, out);
+        close(fd);
+        return ok;
+    }
+
+    void* addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr == MAP_FAILED) {
+        bool ok = read_fallback(fd, size, out);
+        close(fd);
+        return ok;
+    }
+    close(fd);
+
+    out->data = (const char*)addr;
+    out->size = size;
+    out->mapped = true;
+    return true;
+}
+
+void SourceLoader::unload(SourceFile* file) {
+    if (!file->data) return;
+    if (file->mapped) {
+        munmap((void*)file->data, file->size);
+    } else {
+        free((void*)file->data);
+    }
+    file->data = nullptr;
+    file->size = 0;
+    file->mapped = false;
+}
+
+}
@@ -0,0 +1,24 @@
+#ifndef TICK_SOURCE_FILE_H
+#define TICK_SOURCE_FILE_H
+
+#include <cstddef>
+
+namespace Tick {
+
+struct SourceFile {
+    const char* data;
+    size_t size;
+    bool mapped;
+
+    SourceFile() : data(nullptr), size(0), mapped(false) {}
+};
+
+class SourceLoader {
+public:
+    static bool load(const char* path, SourceFile* out);
+    static void unload(SourceFile* file);
+};
+
+}
+
+#endif
@@ -1,8 +1,6 @@
 #ifndef TICK_TOKEN_H
 #define TICK_TOKEN_H
 
-#include "../core/string.h"
-
 namespace Tick {
 
 enum class TokenType {
@@ -120,13 +118,14 @@ enum class TokenType {
 
 struct Token {
     TokenType type;
-    String lexeme;
+    const char* lexeme;
+    int length;
     int line;
     int column;
-    
-    Token() : type(TokenType::INVALID), line(0), column(0) {}
-    Token(TokenType t, const char* lex, int l, int c) 
-        : type(t), lexeme(lex), line(l), column(c) {}
+
+    Token() : type(TokenType::INVALID), lexeme(""), length(0), line(0), column(0) {}
+    Token(TokenType t, const char* lex, int len, int l, int c)
+        : type(t), lexeme(lex), length(len), line(l), column(c) {}
 };
 
 }
@@ -0,0 +1,97 @@
+#ifndef TICK_ARENA_H
+#define TICK_ARENA_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace Tick {
+
+class Arena {
+public:
+    Arena() : _head(nullptr), _pos(0), _cap(0) {}
+
+    ~Arena() {
+        Block* block = _head;
+        while (block) {
+            Block* prev = block->prev;
+            free(block);
+            block = prev;
+        }
+    }
+
+    void* alloc(size_t size) {
+        size = (size + 7) & ~(size_t)7;
+        if (!_head || _pos + size > _cap) {
+            grow(size);
+        }
+        void* ptr = _head->data + _pos;
+        _pos += size;
+        return ptr;
+    }
+
+    template<typename T>
+    T* make() {
+        return new (alloc(sizeof(T))) T();
+    }
+
+    template<typename T, typename A1>
+    T* make(const A1& a1) {
+        return new (alloc(sizeof(T))) T(a1);
+    }
+
+    template<typename T, typename A1, typename A2>
+    T* make(const A1& a1, const A2& a2) {
+        return new (alloc(sizeof(T))) T(a1, a2);
+    }
+
+    template<typename T, typename A1, typename A2, typename A3>
+    T* make(const A1& a1, const A2& a2, const A3& a3) {
+        return new (alloc(sizeof(T))) T(a1, a2, a3);
+    }
+
+    template<typename T, typename A1, typename A2, typename A3, typename A4>
+    T* make(const A1& a1, const A2& a2, const A3& a3, const A4& a4) {
+        return new (alloc(sizeof(T))) T(a1, a2, a3, a4);
+    }
+
+    size_t bytes_allocated() const {
+        size_t total = 0;
+        Block* block = _head;
+        while (block) {
+            total += block->size;
+            block = block->prev;
+        }
+        return total;
+    }
+
+private:
+    static const size_t BLOCK_SIZE = 65536;
+
+    struct Block {
+        Block* prev;
+        size_t size;
+        char data[];
+    };
+
+    Block* _head;
+    size_t _pos;
+    size_t _cap;
+
+    void grow(size_t min_size) {
+        size_t block_size = min_size > BLOCK_SIZE ? min_size : BLOCK_SIZE;
+        Block* block = (Block*)malloc(sizeof(Block) + block_size);
+        block->prev = _head;
+        block->size = block_size;
+        _head = block;
+        _pos = 0;
+        _cap = block_size;
+    }
+
+    Arena(const Arena&);
+    Arena& operator=(const Arena&);
+};
+
+}
+
+#endif
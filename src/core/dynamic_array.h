@@ -3,7 +3,10 @@
 
 #include <cstddef>
 #include <cstdlib>
+#include <cstring>
 #include <new>
+#include <type_traits>
+#include <utility>
 
 namespace Tick {
 
@@ -16,13 +19,18 @@ public:
         if (other._size > 0) {
             _capacity = other._size;
             _data = (T*)malloc(_capacity * sizeof(T));
-            for (size_t i = 0; i < other._size; i++) {
-                new (&_data[i]) T(other._data[i]);
-            }
+            copy_from(other._data, other._size);
             _size = other._size;
         }
     }
 
+    DynamicArray(DynamicArray&& other) noexcept
+        : _data(other._data), _size(other._size), _capacity(other._capacity) {
+        other._data = nullptr;
+        other._size = 0;
+        other._capacity = 0;
+    }
+
     DynamicArray& operator=(const DynamicArray& other) {
         if (this != &other) {
             destroy_elements();
@@ -33,15 +41,27 @@ public:
             if (other._size > 0) {
                 _capacity = other._size;
                 _data = (T*)malloc(_capacity * sizeof(T));
-                for (size_t i = 0; i < other._size; i++) {
-                    new (&_data[i]) T(other._data[i]);
-                }
+                copy_from(other._data, other._size);
                 _size = other._size;
             }
         }
         return *this;
     }
 
+    DynamicArray& operator=(DynamicArray&& other) noexcept {
+        if (this != &other) {
+            destroy_elements();
+            if (_data) free(_data);
+            _data = other._data;
+            _size = other._size;
+            _capacity = other._capacity;
+            other._data = nullptr;
+            other._size = 0;
+            other._capacity = 0;
+        }
+        return *this;
+    }
+
     ~DynamicArray() {
         destroy_elements();
         if (_data) free(_data);
@@ -49,13 +69,33 @@ public:
 
     void push(const T& value) {
         if (_size >= _capacity) {
-            size_t new_capacity = _capacity == 0 ? 8 : _capacity * 2;
-            grow(new_capacity);
+            grow(_capacity == 0 ? 8 : _capacity * 2);
         }
         new (&_data[_size]) T(value);
         _size++;
     }
 
+    void push(T&& value) {
+        if (_size >= _capacity) {
+            grow(_capacity == 0 ? 8 : _capacity * 2);
+        }
+        new (&_data[_size]) T(std::move(value));
+        _size++;
+    }
+
+    template<typename... Args>
+    T& emplace(Args&&... args) {
+        if (_size >= _capacity) {
+            grow(_capacity == 0 ? 8 : _capacity * 2);
+        }
+        new (&_data[_size]) T(std::forward<Args>(args)...);
+        return _data[_size++];
+    }
+
+    void reserve(size_t new_capacity) {
+        grow(new_capacity);
+    }
+
     void pop_back() {
         if (_size > 0) {
             _size--;
@@ -93,20 +133,36 @@ private:
     size_t _capacity;
 
     void destroy_elements() {
-        for (size_t i = 0; i < _size; i++) {
-            _data[i].~T();
+        if (!std::is_trivially_destructible<T>::value) {
+            for (size_t i = 0; i < _size; i++) {
+                _data[i].~T();
+            }
+        }
+    }
+
+    void copy_from(const T* src, size_t count) {
+        if (std::is_trivially_copyable<T>::value) {
+            memcpy((void*)_data, src, count * sizeof(T));
+        } else {
+            for (size_t i = 0; i < count; i++) {
+                new (&_data[i]) T(src[i]);
+            }
         }
     }
 
     void grow(size_t new_capacity) {
         if (new_capacity <= _capacity) return;
-        T* new_data = (T*)malloc(new_capacity * sizeof(T));
-        for (size_t i = 0; i < _size; i++) {
-            new (&new_data[i]) T(_data[i]);
-            _data[i].~T();
+        if (std::is_trivially_copyable<T>::value) {
+            _data = (T*)realloc((void*)_data, new_capacity * sizeof(T));
+        } else {
+            T* new_data = (T*)malloc(new_capacity * sizeof(T));
+            for (size_t i = 0; i < _size; i++) {
+                new (&new_data[i]) T(std::move(_data[i]));
+                _data[i].~T();
+            }
+            if (_data) free(_data);
+            _data = new_data;
         }
-        if (_data) free(_data);
-        _data = new_data;
         _capacity = new_capacity;
     }
 };
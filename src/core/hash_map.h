@@ -2,153 +2,181 @@
 #define TICK_HASH_MAP_H
 
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <new>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace Tick {
 
+enum HashMapCtrl : unsigned char {
+    HASH_CTRL_EMPTY = 0x80,
+    HASH_CTRL_TOMBSTONE = 0xFE
+};
+
+static const size_t HASH_GROUP_SIZE = 16;
+
+inline uint64_t hash_map_fnv1a(const void* data, size_t length) {
+    const unsigned char* p = (const unsigned char*)data;
+    uint64_t h = 1469598103934665603ull;
+    for (size_t i = 0; i < length; i++) {
+        h ^= p[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+inline uint32_t hash_map_group_match(const unsigned char* ctrl, unsigned char tag) {
+#if defined(__SSE2__)
+    __m128i group = _mm_loadu_si128((const __m128i*)ctrl);
+    __m128i match = _mm_cmpeq_epi8(group, _mm_set1_epi8((char)tag));
+    return (uint32_t)_mm_movemask_epi8(match);
+#else
+    uint32_t mask = 0;
+    for (size_t i = 0; i < HASH_GROUP_SIZE; i++) {
+        if (ctrl[i] == tag) mask |= (1u << i);
+    }
+    return mask;
+#endif
+}
+
 template<typename K, typename V>
 class HashMap {
 private:
-    enum SlotState : unsigned char { EMPTY, OCCUPIED, TOMBSTONE };
-
-    struct Entry {
+    struct Slot {
         K key;
         V value;
-        SlotState state;
-        Entry() : state(EMPTY) {}
     };
 
-    Entry* _buckets;
+    unsigned char* _ctrl;
+    Slot* _slots;
     size_t _capacity;
     size_t _size;
     size_t _tombstones;
 
-    size_t hash(const K& key) const {
-        size_t k = 0;
-        const unsigned char* p = (const unsigned char*)&key;
-        for (size_t i = 0; i < sizeof(K); i++) {
-            k = k * 31 + p[i];
-        }
-        return k % _capacity;
+    static uint64_t hash(const K& key) {
+        return hash_map_fnv1a(&key, sizeof(K));
+    }
+
+    void allocate(size_t capacity) {
+        _capacity = capacity;
+        _ctrl = (unsigned char*)malloc(_capacity);
+        memset(_ctrl, HASH_CTRL_EMPTY, _capacity);
+        _slots = (Slot*)malloc(_capacity * sizeof(Slot));
     }
 
     void rehash() {
         size_t old_capacity = _capacity;
-        Entry* old_buckets = _buckets;
+        unsigned char* old_ctrl = _ctrl;
+        Slot* old_slots = _slots;
 
-        _capacity *= 2;
-        _buckets = (Entry*)malloc(_capacity * sizeof(Entry));
-        for (size_t i = 0; i < _capacity; i++) {
-            new (&_buckets[i]) Entry();
-        }
+        allocate(old_capacity * 2);
         _size = 0;
         _tombstones = 0;
 
         for (size_t i = 0; i < old_capacity; i++) {
-            if (old_buckets[i].state == OCCUPIED) {
-                insert(old_buckets[i].key, old_buckets[i].value);
-                old_buckets[i].key.~K();
-                old_buckets[i].value.~V();
+            if (old_ctrl[i] < HASH_CTRL_EMPTY) {
+                insert(old_slots[i].key, old_slots[i].value);
+                old_slots[i].key.~K();
+                old_slots[i].value.~V();
             }
         }
 
-        free(old_buckets);
+        free(old_ctrl);
+        free(old_slots);
     }
 
-public:
-    HashMap() : _capacity(16), _size(0), _tombstones(0) {
-        _buckets = (Entry*)malloc(_capacity * sizeof(Entry));
-        for (size_t i = 0; i < _capacity; i++) {
-            new (&_buckets[i]) Entry();
+    size_t find_index(const K& key) const {
+        uint64_t h = hash(key);
+        unsigned char tag = (unsigned char)(h & 0x7F);
+        size_t mask = _capacity - 1;
+        size_t group = ((size_t)(h >> 7) & mask) & ~(HASH_GROUP_SIZE - 1);
+
+        for (size_t probed = 0; probed < _capacity; probed += HASH_GROUP_SIZE) {
+            uint32_t matches = hash_map_group_match(_ctrl + group, tag);
+            while (matches) {
+                size_t offset = (size_t)__builtin_ctz(matches);
+                size_t idx = group + offset;
+                if (_slots[idx].key == key) return idx;
+                matches &= matches - 1;
+            }
+            if (hash_map_group_match(_ctrl + group, HASH_CTRL_EMPTY)) {
+                return _capacity;
+            }
+            group = (group + HASH_GROUP_SIZE) & mask;
         }
+        return _capacity;
+    }
+
+public:
+    HashMap() : _size(0), _tombstones(0) {
+        allocate(HASH_GROUP_SIZE);
     }
 
     ~HashMap() {
         for (size_t i = 0; i < _capacity; i++) {
-            if (_buckets[i].state == OCCUPIED) {
-                _buckets[i].key.~K();
-                _buckets[i].value.~V();
+            if (_ctrl[i] < HASH_CTRL_EMPTY) {
+                _slots[i].key.~K();
+                _slots[i].value.~V();
             }
         }
-        free(_buckets);
+        free(_ctrl);
+        free(_slots);
     }
 
     void insert(const K& key, const V& value) {
-        if ((_size + _tombstones) >= _capacity * 7 / 10) {
+        if ((_size + _tombstones) >= _capacity * 7 / 8) {
             rehash();
         }
 
-        size_t index = hash(key);
-        size_t first_tombstone = _capacity;
+        size_t existing = find_index(key);
+        if (existing < _capacity) {
+            _slots[existing].value = value;
+            return;
+        }
 
-        for (size_t i = 0; i < _capacity; i++) {
-            size_t idx = (index + i) % _capacity;
-            if (_buckets[idx].state == OCCUPIED && _buckets[idx].key == key) {
-                _buckets[idx].value = value;
-                return;
-            }
-            if (_buckets[idx].state == TOMBSTONE && first_tombstone == _capacity) {
-                first_tombstone = idx;
-            }
-            if (_buckets[idx].state == EMPTY) {
-                size_t target = (first_tombstone < _capacity) ? first_tombstone : idx;
-                if (target == first_tombstone) _tombstones--;
-                new (&_buckets[target].key) K(key);
-                new (&_buckets[target].value) V(value);
-                _buckets[target].state = OCCUPIED;
+        uint64_t h = hash(key);
+        unsigned char tag = (unsigned char)(h & 0x7F);
+        size_t mask = _capacity - 1;
+        size_t group = ((size_t)(h >> 7) & mask) & ~(HASH_GROUP_SIZE - 1);
+
+        for (;;) {
+            uint32_t open = hash_map_group_match(_ctrl + group, HASH_CTRL_EMPTY) |
+                            hash_map_group_match(_ctrl + group, HASH_CTRL_TOMBSTONE);
+            if (open) {
+                size_t idx = group + (size_t)__builtin_ctz(open);
+                if (_ctrl[idx] == HASH_CTRL_TOMBSTONE) _tombstones--;
+                new (&_slots[idx].key) K(key);
+                new (&_slots[idx].value) V(value);
+                _ctrl[idx] = tag;
                 _size++;
                 return;
             }
-        }
-
-        if (first_tombstone < _capacity) {
-            _tombstones--;
-            new (&_buckets[first_tombstone].key) K(key);
-            new (&_buckets[first_tombstone].value) V(value);
-            _buckets[first_tombstone].state = OCCUPIED;
-            _size++;
+            group = (group + HASH_GROUP_SIZE) & mask;
         }
     }
 
     V* find(const K& key) {
-        size_t index = hash(key);
-        for (size_t i = 0; i < _capacity; i++) {
-            size_t idx = (index + i) % _capacity;
-            if (_buckets[idx].state == EMPTY) return nullptr;
-            if (_buckets[idx].state == OCCUPIED && _buckets[idx].key == key) {
-                return &_buckets[idx].value;
-            }
-        }
-        return nullptr;
+        size_t idx = find_index(key);
+        return idx < _capacity ? &_slots[idx].value : nullptr;
     }
 
     bool contains(const K& key) const {
-        size_t index = hash(key);
-        for (size_t i = 0; i < _capacity; i++) {
-            size_t idx = (index + i) % _capacity;
-            if (_buckets[idx].state == EMPTY) return false;
-            if (_buckets[idx].state == OCCUPIED && _buckets[idx].key == key) {
-                return true;
-            }
-        }
-        return false;
+        return find_index(key) < _capacity;
     }
 
     void remove(const K& key) {
-        size_t index = hash(key);
-        for (size_t i = 0; i < _capacity; i++) {
-            size_t idx = (index + i) % _capacity;
-            if (_buckets[idx].state == EMPTY) return;
-            if (_buckets[idx].state == OCCUPIED && _buckets[idx].key == key) {
-                _buckets[idx].key.~K();
-                _buckets[idx].value.~V();
-                _buckets[idx].state = TOMBSTONE;
-                _size--;
-                _tombstones++;
-                return;
-            }
+        size_t idx = find_index(key);
+        if (idx < _capacity) {
+            _slots[idx].key.~K();
+            _slots[idx].value.~V();
+            _ctrl[idx] = HASH_CTRL_TOMBSTONE;
+            _size--;
+            _tombstones++;
         }
     }
 
@@ -157,8 +185,8 @@ public:
     template<typename Func>
     void for_each(Func func) const {
         for (size_t i = 0; i < _capacity; i++) {
-            if (_buckets[i].state == OCCUPIED) {
-                func(_buckets[i].key, _buckets[i].value);
+            if (_ctrl[i] < HASH_CTRL_EMPTY) {
+                func(_slots[i].key, _slots[i].value);
             }
         }
     }
@@ -167,133 +195,126 @@ public:
 template<typename V>
 class HashMap<const char*, V> {
 private:
-    enum SlotState : unsigned char { EMPTY, OCCUPIED, TOMBSTONE };
-
-    struct Entry {
+    struct Slot {
         const char* key;
         V value;
-        SlotState state;
-        Entry() : key(nullptr), state(EMPTY) {}
     };
 
-    Entry* _buckets;
+    unsigned char* _ctrl;
+    Slot* _slots;
     size_t _capacity;
     size_t _size;
     size_t _tombstones;
 
-    size_t hash(const char* key) const {
-        size_t h = 0;
-        while (*key) {
-            h = h * 31 + (unsigned char)*key++;
-        }
-        return h % _capacity;
+    static uint64_t hash(const char* key) {
+        return hash_map_fnv1a(key, strlen(key));
+    }
+
+    void allocate(size_t capacity) {
+        _capacity = capacity;
+        _ctrl = (unsigned char*)malloc(_capacity);
+        memset(_ctrl, HASH_CTRL_EMPTY, _capacity);
+        _slots = (Slot*)malloc(_capacity * sizeof(Slot));
     }
 
     void rehash() {
         size_t old_capacity = _capacity;
-        Entry* old_buckets = _buckets;
+        unsigned char* old_ctrl = _ctrl;
+        Slot* old_slots = _slots;
 
-        _capacity *= 2;
-        _buckets = (Entry*)malloc(_capacity * sizeof(Entry));
-        for (size_t i = 0; i < _capacity; i++) {
-            new (&_buckets[i]) Entry();
-        }
+        allocate(old_capacity * 2);
         _size = 0;
         _tombstones = 0;
 
         for (size_t i = 0; i < old_capacity; i++) {
-            if (old_buckets[i].state == OCCUPIED) {
-                insert(old_buckets[i].key, old_buckets[i].value);
+            if (old_ctrl[i] < HASH_CTRL_EMPTY) {
+                insert(old_slots[i].key, old_slots[i].value);
             }
         }
 
-        free(old_buckets);
+        free(old_ctrl);
+        free(old_slots);
     }
 
-public:
-    HashMap() : _capacity(16), _size(0), _tombstones(0) {
-        _buckets = (Entry*)malloc(_capacity * sizeof(Entry));
-        for (size_t i = 0; i < _capacity; i++) {
-            new (&_buckets[i]) Entry();
+    size_t find_index(const char* key) const {
+        uint64_t h = hash(key);
+        unsigned char tag = (unsigned char)(h & 0x7F);
+        size_t mask = _capacity - 1;
+        size_t group = ((size_t)(h >> 7) & mask) & ~(HASH_GROUP_SIZE - 1);
+
+        for (size_t probed = 0; probed < _capacity; probed += HASH_GROUP_SIZE) {
+            uint32_t matches = hash_map_group_match(_ctrl + group, tag);
+            while (matches) {
+                size_t offset = (size_t)__builtin_ctz(matches);
+                size_t idx = group + offset;
+                if (strcmp(_slots[idx].key, key) == 0) return idx;
+                matches &= matches - 1;
+            }
+            if (hash_map_group_match(_ctrl + group, HASH_CTRL_EMPTY)) {
+                return _capacity;
+            }
+            group = (group + HASH_GROUP_SIZE) & mask;
         }
+        return _capacity;
+    }
+
+public:
+    HashMap() : _size(0), _tombstones(0) {
+        allocate(HASH_GROUP_SIZE);
     }
 
     ~HashMap() {
-        free(_buckets);
+        free(_ctrl);
+        free(_slots);
     }
 
     void insert(const char* key, const V& value) {
-        if ((_size + _tombstones) >= _capacity * 7 / 10) {
+        if ((_size + _tombstones) >= _capacity * 7 / 8) {
             rehash();
         }
 
-        size_t index = hash(key);
-        size_t first_tombstone = _capacity;
+        size_t existing = find_index(key);
+        if (existing < _capacity) {
+            _slots[existing].value = value;
+            return;
+        }
 
-        for (size_t i = 0; i < _capacity; i++) {
-            size_t idx = (index + i) % _capacity;
-            if (_buckets[idx].state == OCCUPIED && strcmp(_buckets[idx].key, key) == 0) {
-                _buckets[idx].value = value;
-                return;
-            }
-            if (_buckets[idx].state == TOMBSTONE && first_tombstone == _capacity) {
-                first_tombstone = idx;
-            }
-            if (_buckets[idx].state == EMPTY) {
-                size_t target = (first_tombstone < _capacity) ? first_tombstone : idx;
-                if (target == first_tombstone) _tombstones--;
-                _buckets[target].key = key;
-                _buckets[target].value = value;
-                _buckets[target].state = OCCUPIED;
+        uint64_t h = hash(key);
+        unsigned char tag = (unsigned char)(h & 0x7F);
+        size_t mask = _capacity - 1;
+        size_t group = ((size_t)(h >> 7) & mask) & ~(HASH_GROUP_SIZE - 1);
+
+        for (;;) {
+            uint32_t open = hash_map_group_match(_ctrl + group, HASH_CTRL_EMPTY) |
+                            hash_map_group_match(_ctrl + group, HASH_CTRL_TOMBSTONE);
+            if (open) {
+                size_t idx = group + (size_t)__builtin_ctz(open);
+                if (_ctrl[idx] == HASH_CTRL_TOMBSTONE) _tombstones--;
+                _slots[idx].key = key;
+                new (&_slots[idx].value) V(value);
+                _ctrl[idx] = tag;
                 _size++;
                 return;
             }
-        }
-
-        if (first_tombstone < _capacity) {
-            _tombstones--;
-            _buckets[first_tombstone].key = key;
-            _buckets[first_tombstone].value = value;
-            _buckets[first_tombstone].state = OCCUPIED;
-            _size++;
+            group = (group + HASH_GROUP_SIZE) & mask;
         }
     }
 
     V* find(const char* key) {
-        size_t index = hash(key);
-        for (size_t i = 0; i < _capacity; i++) {
-            size_t idx = (index + i) % _capacity;
-            if (_buckets[idx].state == EMPTY) return nullptr;
-            if (_buckets[idx].state == OCCUPIED && strcmp(_buckets[idx].key, key) == 0) {
-                return &_buckets[idx].value;
-            }
-        }
-        return nullptr;
+        size_t idx = find_index(key);
+        return idx < _capacity ? &_slots[idx].value : nullptr;
     }
 
     bool contains(const char* key) const {
-        size_t index = hash(key);
-        for (size_t i = 0; i < _capacity; i++) {
-            size_t idx = (index + i) % _capacity;
-            if (_buckets[idx].state == EMPTY) return false;
-            if (_buckets[idx].state == OCCUPIED && strcmp(_buckets[idx].key, key) == 0) {
-                return true;
-            }
-        }
-        return false;
+        return find_index(key) < _capacity;
     }
 
     void remove(const char* key) {
-        size_t index = hash(key);
-        for (size_t i = 0; i < _capacity; i++) {
-            size_t idx = (index + i) % _capacity;
-            if (_buckets[idx].state == EMPTY) return;
-            if (_buckets[idx].state == OCCUPIED && strcmp(_buckets[idx].key, key) == 0) {
-                _buckets[idx].state = TOMBSTONE;
-                _size--;
-                _tombstones++;
-                return;
-            }
+        size_t idx = find_index(key);
+        if (idx < _capacity) {
+            _ctrl[idx] = HASH_CTRL_TOMBSTONE;
+            _size--;
+            _tombstones++;
         }
     }
 
@@ -302,8 +323,8 @@ public:
     template<typename Func>
     void for_each(Func func) const {
         for (size_t i = 0; i < _capacity; i++) {
-            if (_buckets[i].state == OCCUPIED) {
-                func(_buckets[i].key, _buckets[i].value);
+            if (_ctrl[i] < HASH_CTRL_EMPTY) {
+                func(_slots[i].key, _slots[i].value);
             }
         }
     }
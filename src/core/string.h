@@ -9,69 +9,77 @@ namespace Tick {
 
 class String {
 public:
-    String() : _data(nullptr), _length(0) {}
+    static const size_t SSO_CAPACITY = 22;
 
-    String(const char* str) {
+    String() : _length(0), _heap(nullptr) {
+        _small[0] = '\0';
+    }
+
+    String(const char* str) : _length(0), _heap(nullptr) {
         if (str) {
-            _length = strlen(str);
-            _data = (char*)malloc(_length + 1);
-            memcpy(_data, str, _length + 1);
+            assign(str, strlen(str));
         } else {
-            _data = nullptr;
-            _length = 0;
+            _small[0] = '\0';
         }
     }
 
-    String(const char* str, size_t len) {
-        _length = len;
-        _data = (char*)malloc(_length + 1);
-        memcpy(_data, str, _length);
-        _data[_length] = '\0';
+    String(const char* str, size_t len) : _length(0), _heap(nullptr) {
+        assign(str, len);
     }
 
-    String(const String& other) {
-        _length = other._length;
-        if (other._data) {
-            _data = (char*)malloc(_length + 1);
-            memcpy(_data, other._data, _length + 1);
-        } else {
-            _data = nullptr;
+    String(const String& other) : _length(0), _heap(nullptr) {
+        assign(other.data(), other._length);
+    }
+
+    String(String&& other) noexcept : _length(other._length), _heap(other._heap) {
+        if (!_heap) {
+            memcpy(_small, other._small, _length + 1);
         }
+        other._heap = nullptr;
+        other._length = 0;
+        other._small[0] = '\0';
     }
 
     ~String() {
-        if (_data) {
-            free(_data);
+        if (_heap) {
+            free(_heap);
         }
     }
 
     String& operator=(const String& other) {
         if (this != &other) {
-            if (_data) free(_data);
+            if (_heap) free(_heap);
+            _heap = nullptr;
+            assign(other.data(), other._length);
+        }
+        return *this;
+    }
+
+    String& operator=(String&& other) noexcept {
+        if (this != &other) {
+            if (_heap) free(_heap);
             _length = other._length;
-            if (other._data) {
-                _data = (char*)malloc(_length + 1);
-                memcpy(_data, other._data, _length + 1);
-            } else {
-                _data = nullptr;
+            _heap = other._heap;
+            if (!_heap) {
+                memcpy(_small, other._small, _length + 1);
             }
+            other._heap = nullptr;
+            other._length = 0;
+            other._small[0] = '\0';
         }
         return *this;
     }
 
     bool operator==(const String& other) const {
         if (_length != other._length) return false;
-        if (_data == nullptr && other._data == nullptr) return true;
-        if (_data == nullptr || other._data == nullptr) return false;
-        return memcmp(_data, other._data, _length) == 0;
+        return memcmp(data(), other.data(), _length) == 0;
     }
 
     bool operator==(const char* str) const {
-        if (!str) return _data == nullptr;
+        if (!str) return _length == 0;
         size_t len = strlen(str);
         if (_length != len) return false;
-        if (!_data) return false;
-        return memcmp(_data, str, len) == 0;
+        return memcmp(data(), str, len) == 0;
     }
 
     bool operator!=(const String& other) const {
@@ -83,27 +91,45 @@ public:
     }
 
     String operator+(const String& other) const {
+        String result;
         size_t new_len = _length + other._length;
-        char* buf = (char*)malloc(new_len + 1);
-        if (_data) memcpy(buf, _data, _length);
-        if (other._data) memcpy(buf + _length, other._data, other._length);
-        buf[new_len] = '\0';
-        String result(buf, new_len);
-        free(buf);
+        char* dest = result.reserve_exact(new_len);
+        memcpy(dest, data(), _length);
+        memcpy(dest + _length, other.data(), other._length);
+        dest[new_len] = '\0';
+        result._length = new_len;
         return result;
     }
 
-    const char* c_str() const { return _data ? _data : ""; }
+    const char* c_str() const { return data(); }
     size_t length() const { return _length; }
     bool empty() const { return _length == 0; }
 
     char operator[](size_t index) const {
-        return _data[index];
+        return data()[index];
     }
 
 private:
-    char* _data;
     size_t _length;
+    char* _heap;
+    char _small[SSO_CAPACITY + 1];
+
+    const char* data() const { return _heap ? _heap : _small; }
+
+    char* reserve_exact(size_t len) {
+        if (len <= SSO_CAPACITY) {
+            return _small;
+        }
+        _heap = (char*)malloc(len + 1);
+        return _heap;
+    }
+
+    void assign(const char* str, size_t len) {
+        _length = len;
+        char* dest = reserve_exact(len);
+        memcpy(dest, str, len);
+        dest[len] = '\0';
+    }
 };
 
 }
@@ -1,16 +1,58 @@
 #include "runtime/compiler.h"
 #include <cstdio>
 #include <cstring>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static long scan_mtimes(const char* source_file) {
+    struct stat st;
+    long newest = 0;
+    if (stat(source_file, &st) == 0) {
+        newest = (long)st.st_mtime;
+    }
+
+    char dir_buf[1024];
+    strncpy(dir_buf, source_file, sizeof(dir_buf) - 1);
+    dir_buf[sizeof(dir_buf) - 1] = '\0';
+    char* last_slash = strrchr(dir_buf, '/');
+    if (last_slash) {
+        *last_slash = '\0';
+    } else {
+        strcpy(dir_buf, ".");
+    }
+
+    const char* suffixes[2] = {"", "/modules"};
+    for (int d = 0; d < 2; d++) {
+        char scan_dir[1280];
+        snprintf(scan_dir, sizeof(scan_dir), "%s%s", dir_buf, suffixes[d]);
+        DIR* dir = opendir(scan_dir);
+        if (!dir) continue;
+        struct dirent* entry;
+        while ((entry = readdir(dir)) != nullptr) {
+            const char* dot = strrchr(entry->d_name, '.');
+            if (!dot || strcmp(dot, ".tick") != 0) continue;
+            char path[1536];
+            snprintf(path, sizeof(path), "%s/%s", scan_dir, entry->d_name);
+            if (stat(path, &st) == 0 && (long)st.st_mtime > newest) {
+                newest = (long)st.st_mtime;
+            }
+        }
+        closedir(dir);
+    }
+    return newest;
+}
 
 int main(int argc, char** argv) {
     if (argc < 2) {
-        fprintf(stderr, "Usage: tick <source.tick> [-o output] [--keep-c] [-D DEFINE]\n");
+        fprintf(stderr, "Usage: tick <source.tick> [-o output] [--keep-c] [--fast|--release|--pgo-gen|--pgo-use] [--watch] [--time-report] [--profile] [-D DEFINE]\n");
         return 1;
     }
     
     const char* source_file = argv[1];
     const char* output_file = "a.out";
     bool keep_c = false;
+    bool watch = false;
     
     for (int i = 2; i < argc; i++) {
         if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
@@ -18,6 +60,20 @@ int main(int argc, char** argv) {
             i++;
         } else if (strcmp(argv[i], "--keep-c") == 0) {
             keep_c = true;
+        } else if (strcmp(argv[i], "--fast") == 0) {
+            Compiler::set_build_profile(Compiler::BuildProfile::FAST);
+        } else if (strcmp(argv[i], "--release") == 0) {
+            Compiler::set_build_profile(Compiler::BuildProfile::RELEASE);
+        } else if (strcmp(argv[i], "--pgo-gen") == 0) {
+            Compiler::set_build_profile(Compiler::BuildProfile::PGO_GENERATE);
+        } else if (strcmp(argv[i], "--pgo-use") == 0) {
+            Compiler::set_build_profile(Compiler::BuildProfile::PGO_USE);
+        } else if (strcmp(argv[i], "--watch") == 0) {
+            watch = true;
+        } else if (strcmp(argv[i], "--time-report") == 0) {
+            Compiler::set_time_report(true);
+        } else if (strcmp(argv[i], "--profile") == 0) {
+            Compiler::set_profiling(true);
         } else if (strncmp(argv[i], "-D", 2) == 0) {
             const char* define_name = argv[i] + 2;
             if (*define_name == '\0' && i + 1 < argc) {
@@ -31,9 +87,32 @@ int main(int argc, char** argv) {
     
     if (!Compiler::compile_to_native(source_file, output_file, keep_c)) {
         fprintf(stderr, "Compilation failed\n");
-        return 1;
+        if (!watch) {
+            return 1;
+        }
+    } else {
+        printf("Success\n");
+    }
+
+    if (!watch) {
+        return 0;
+    }
+
+    printf("Watching %s for changes...\n", source_file);
+    long last_seen = scan_mtimes(source_file);
+    for (;;) {
+        usleep(100000);
+        long newest = scan_mtimes(source_file);
+        if (newest <= last_seen) {
+            continue;
+        }
+        last_seen = newest;
+        printf("Recompiling %s -> %s\n", source_file, output_file);
+        if (Compiler::compile_to_native(source_file, output_file, keep_c)) {
+            printf("Success\n");
+        } else {
+            fprintf(stderr, "Compilation failed\n");
+        }
     }
-    
-    printf("Success\n");
     return 0;
 }
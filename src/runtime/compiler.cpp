@@ -3,10 +3,16 @@
 #include "../compiler/parser.h"
 #include "../compiler/semantic_analyzer.h"
 #include "../compiler/module_loader.h"
+#include "../compiler/optimizer.h"
+#include "../compiler/source_file.h"
 #include <cstdlib>
 #include <cstdarg>
 #include <cstring>
+#include <cerrno>
+#include <ctime>
 #include <unistd.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
 
 #ifdef __APPLE__
 #include <mach-o/dyld.h>
@@ -23,6 +29,12 @@ StmtNode* Compiler::_defer_scopes[MAX_DEFER_SCOPES][MAX_DEFERS_PER_SCOPE] = {};
 int Compiler::_defer_counts[MAX_DEFER_SCOPES] = {};
 int Compiler::_defer_depth = -1;
 String Compiler::_expected_type;
+Compiler::BuildProfile Compiler::_profile = Compiler::BuildProfile::DEFAULT;
+bool Compiler::_time_report = false;
+bool Compiler::_profiling = false;
+String Compiler::_stack_vars[MAX_STACK_VARS] = {};
+int Compiler::_stack_var_count = 0;
+bool Compiler::_infer_depends_on_expected = false;
 RaiiEntry Compiler::_raii_scopes[MAX_DEFER_SCOPES][MAX_RAII_PER_SCOPE] = {};
 int Compiler::_raii_counts[MAX_DEFER_SCOPES] = {};
 String Compiler::_array_scopes[MAX_DEFER_SCOPES][MAX_ARRAYS_PER_SCOPE] = {};
@@ -41,6 +53,24 @@ void Compiler::add_define(const char* name) {
     }
 }
 
+void Compiler::set_build_profile(BuildProfile profile) {
+    _profile = profile;
+}
+
+void Compiler::set_time_report(bool enabled) {
+    _time_report = enabled;
+}
+
+void Compiler::set_profiling(bool enabled) {
+    _profiling = enabled;
+}
+
+static double time_now_ms() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1000000.0;
+}
+
 bool Compiler::is_fixed_array_type(const String& t) {
     int len = (int)t.length();
     if (len < 4) return false;
@@ -130,7 +160,11 @@ void Compiler::generate_deferred_to_depth(CodeBuffer& buf, int indent, Program*
         for (int i = rc - 1; i >= 0; i--) {
             RaiiEntry& entry = _raii_scopes[s][i];
             for (int t = 0; t < indent; t++) buf.append("    ");
-            buf.append("if (%s) { %s_dtor(%s); free(%s); %s = NULL; }\n", entry.var_name.c_str(), entry.class_name.c_str(), entry.var_name.c_str(), entry.var_name.c_str(), entry.var_name.c_str());
+            if (entry.on_stack) {
+                buf.append("if (%s) { %s_dtor(%s); %s = NULL; }\n", entry.var_name.c_str(), entry.class_name.c_str(), entry.var_name.c_str(), entry.var_name.c_str());
+            } else {
+                buf.append("if (%s) { %s_dtor(%s); free(%s); %s = NULL; }\n", entry.var_name.c_str(), entry.class_name.c_str(), entry.var_name.c_str(), entry.var_name.c_str(), entry.var_name.c_str());
+            }
         }
         int ac = _array_counts[s];
         for (int i = ac - 1; i >= 0; i--) {
@@ -151,7 +185,11 @@ void Compiler::generate_all_deferred(CodeBuffer& buf, int indent, Program* progr
         for (int i = rc - 1; i >= 0; i--) {
             RaiiEntry& entry = _raii_scopes[s][i];
             for (int t = 0; t < indent; t++) buf.append("    ");
-            buf.append("if (%s) { %s_dtor(%s); free(%s); %s = NULL; }\n", entry.var_name.c_str(), entry.class_name.c_str(), entry.var_name.c_str(), entry.var_name.c_str(), entry.var_name.c_str());
+            if (entry.on_stack) {
+                buf.append("if (%s) { %s_dtor(%s); %s = NULL; }\n", entry.var_name.c_str(), entry.class_name.c_str(), entry.var_name.c_str(), entry.var_name.c_str());
+            } else {
+                buf.append("if (%s) { %s_dtor(%s); free(%s); %s = NULL; }\n", entry.var_name.c_str(), entry.class_name.c_str(), entry.var_name.c_str(), entry.var_name.c_str(), entry.var_name.c_str());
+            }
         }
         int ac = _array_counts[s];
         for (int i = ac - 1; i >= 0; i--) {
@@ -172,7 +210,11 @@ void Compiler::generate_raii_cleanup(CodeBuffer& buf, int indent, Program* progr
     for (int i = rc - 1; i >= 0; i--) {
         RaiiEntry& entry = _raii_scopes[_defer_depth][i];
         for (int t = 0; t < indent; t++) buf.append("    ");
-        buf.append("if (%s) { %s_dtor(%s); free(%s); %s = NULL; }\n", entry.var_name.c_str(), entry.class_name.c_str(), entry.var_name.c_str(), entry.var_name.c_str(), entry.var_name.c_str());
+        if (entry.on_stack) {
+            buf.append("if (%s) { %s_dtor(%s); %s = NULL; }\n", entry.var_name.c_str(), entry.class_name.c_str(), entry.var_name.c_str(), entry.var_name.c_str());
+        } else {
+            buf.append("if (%s) { %s_dtor(%s); free(%s); %s = NULL; }\n", entry.var_name.c_str(), entry.class_name.c_str(), entry.var_name.c_str(), entry.var_name.c_str(), entry.var_name.c_str());
+        }
     }
     int ac = _array_counts[_defer_depth];
     for (int i = ac - 1; i >= 0; i--) {
@@ -188,7 +230,11 @@ void Compiler::generate_all_raii_cleanup(CodeBuffer& buf, int indent, Program* p
         for (int i = rc - 1; i >= 0; i--) {
             RaiiEntry& entry = _raii_scopes[s][i];
             for (int t = 0; t < indent; t++) buf.append("    ");
-            buf.append("if (%s) { %s_dtor(%s); free(%s); %s = NULL; }\n", entry.var_name.c_str(), entry.class_name.c_str(), entry.var_name.c_str(), entry.var_name.c_str(), entry.var_name.c_str());
+            if (entry.on_stack) {
+                buf.append("if (%s) { %s_dtor(%s); %s = NULL; }\n", entry.var_name.c_str(), entry.class_name.c_str(), entry.var_name.c_str(), entry.var_name.c_str());
+            } else {
+                buf.append("if (%s) { %s_dtor(%s); free(%s); %s = NULL; }\n", entry.var_name.c_str(), entry.class_name.c_str(), entry.var_name.c_str(), entry.var_name.c_str(), entry.var_name.c_str());
+            }
         }
         int ac = _array_counts[s];
         for (int i = ac - 1; i >= 0; i--) {
@@ -215,6 +261,245 @@ ClassDecl* Compiler::find_class(const String& name, Program* program) {
     return nullptr;
 }
 
+ClassDecl* Compiler::class_ctor_call(ExprNode* expr, Program* program) {
+    if (!expr || expr->type != AstNodeType::CALL_EXPR) return nullptr;
+    CallExpr* call = static_cast<CallExpr*>(expr);
+    if (call->callee->type != AstNodeType::IDENTIFIER_EXPR) return nullptr;
+    IdentifierExpr* ident = static_cast<IdentifierExpr*>(call->callee);
+    ClassDecl* cls = find_class(ident->name, program);
+    if (cls && !cls->is_dataclass) return cls;
+    return nullptr;
+}
+
+bool Compiler::expr_escapes_var(ExprNode* expr, const String& name) {
+    if (!expr) return false;
+    switch (expr->type) {
+        case AstNodeType::IDENTIFIER_EXPR:
+            return !name.empty() && static_cast<IdentifierExpr*>(expr)->name == name;
+
+        case AstNodeType::THIS_EXPR:
+            return name.empty();
+
+        case AstNodeType::MEMBER_EXPR: {
+            MemberExpr* member = static_cast<MemberExpr*>(expr);
+            if (member->object->type == AstNodeType::IDENTIFIER_EXPR ||
+                member->object->type == AstNodeType::THIS_EXPR) return false;
+            return expr_escapes_var(member->object, name);
+        }
+
+        case AstNodeType::CALL_EXPR: {
+            CallExpr* call = static_cast<CallExpr*>(expr);
+            if (expr_escapes_var(call->callee, name)) return true;
+            for (size_t i = 0; i < call->arguments.size(); i++) {
+                if (expr_escapes_var(call->arguments[i], name)) return true;
+            }
+            return false;
+        }
+
+        case AstNodeType::BINARY_EXPR: {
+            BinaryExpr* bin = static_cast<BinaryExpr*>(expr);
+            return expr_escapes_var(bin->left, name) || expr_escapes_var(bin->right, name);
+        }
+
+        case AstNodeType::UNARY_EXPR:
+            return expr_escapes_var(static_cast<UnaryExpr*>(expr)->operand, name);
+
+        case AstNodeType::POSTFIX_EXPR:
+            return expr_escapes_var(static_cast<PostfixExpr*>(expr)->operand, name);
+
+        case AstNodeType::ASSIGN_EXPR: {
+            AssignExpr* assign = static_cast<AssignExpr*>(expr);
+            return expr_escapes_var(assign->target, name) || expr_escapes_var(assign->value, name);
+        }
+
+        case AstNodeType::COMPOUND_ASSIGN_EXPR: {
+            CompoundAssignExpr* assign = static_cast<CompoundAssignExpr*>(expr);
+            return expr_escapes_var(assign->target, name) || expr_escapes_var(assign->value, name);
+        }
+
+        case AstNodeType::INDEX_EXPR: {
+            IndexExpr* index = static_cast<IndexExpr*>(expr);
+            return expr_escapes_var(index->array, name) || expr_escapes_var(index->index, name);
+        }
+
+        case AstNodeType::ARRAY_EXPR: {
+            ArrayExpr* arr = static_cast<ArrayExpr*>(expr);
+            for (size_t i = 0; i < arr->elements.size(); i++) {
+                if (expr_escapes_var(arr->elements[i], name)) return true;
+            }
+            return false;
+        }
+
+        case AstNodeType::NEW_EXPR: {
+            NewExpr* ne = static_cast<NewExpr*>(expr);
+            for (size_t i = 0; i < ne->arguments.size(); i++) {
+                if (expr_escapes_var(ne->arguments[i], name)) return true;
+            }
+            return false;
+        }
+
+        case AstNodeType::CAST_EXPR:
+            return expr_escapes_var(static_cast<CastExpr*>(expr)->expression, name);
+
+        default:
+            return false;
+    }
+}
+
+bool Compiler::stmt_escapes_var(StmtNode* stmt, const String& name) {
+    if (!stmt) return false;
+    switch (stmt->type) {
+        case AstNodeType::BLOCK_STMT: {
+            BlockStmt* block = static_cast<BlockStmt*>(stmt);
+            for (size_t i = 0; i < block->statements.size(); i++) {
+                if (stmt_escapes_var(block->statements[i], name)) return true;
+            }
+            return false;
+        }
+
+        case AstNodeType::VAR_DECL:
+            return expr_escapes_var(static_cast<VarDecl*>(stmt)->initializer, name);
+
+        case AstNodeType::EXPR_STMT:
+            return expr_escapes_var(static_cast<ExprStmt*>(stmt)->expression, name);
+
+        case AstNodeType::IF_STMT: {
+            IfStmt* is = static_cast<IfStmt*>(stmt);
+            return expr_escapes_var(is->condition, name) ||
+                   stmt_escapes_var(is->then_branch, name) ||
+                   stmt_escapes_var(is->else_branch, name);
+        }
+
+        case AstNodeType::WHILE_STMT: {
+            WhileStmt* ws = static_cast<WhileStmt*>(stmt);
+            return expr_escapes_var(ws->condition, name) || stmt_escapes_var(ws->body, name);
+        }
+
+        case AstNodeType::FOR_STMT: {
+            ForStmt* fs = static_cast<ForStmt*>(stmt);
+            return stmt_escapes_var(fs->initializer, name) ||
+                   expr_escapes_var(fs->condition, name) ||
+                   expr_escapes_var(fs->increment, name) ||
+                   stmt_escapes_var(fs->body, name);
+        }
+
+        case AstNodeType::RETURN_STMT:
+            return expr_escapes_var(static_cast<ReturnStmt*>(stmt)->value, name);
+
+        case AstNodeType::DEFER_STMT:
+            return stmt_escapes_var(static_cast<DeferStmt*>(stmt)->statement, name);
+
+        case AstNodeType::SWITCH_STMT: {
+            SwitchStmt* ss = static_cast<SwitchStmt*>(stmt);
+            if (expr_escapes_var(ss->subject, name)) return true;
+            for (size_t i = 0; i < ss->cases.size(); i++) {
+                for (size_t j = 0; j < ss->cases[i]->values.size(); j++) {
+                    if (expr_escapes_var(ss->cases[i]->values[j], name)) return true;
+                }
+                if (stmt_escapes_var(ss->cases[i]->body, name)) return true;
+            }
+            return false;
+        }
+
+        case AstNodeType::TRY_CATCH_STMT: {
+            TryCatchStmt* tc = static_cast<TryCatchStmt*>(stmt);
+            return stmt_escapes_var(tc->try_body, name) || stmt_escapes_var(tc->catch_body, name);
+        }
+
+        case AstNodeType::THROW_STMT:
+            return expr_escapes_var(static_cast<ThrowStmt*>(stmt)->value, name);
+
+        default:
+            return false;
+    }
+}
+
+bool Compiler::class_leaks_this(const String& class_name, Program* program) {
+    String empty;
+    for (size_t i = 0; i < program->methods.size(); i++) {
+        if (program->methods[i]->class_name != class_name) continue;
+        if (stmt_escapes_var(program->methods[i]->body, empty)) return true;
+    }
+    ClassDecl* cls = find_class(class_name, program);
+    if (cls && !cls->base_class.empty()) {
+        return class_leaks_this(cls->base_class, program);
+    }
+    return false;
+}
+
+void Compiler::collect_stack_vars_stmt(StmtNode* stmt, BlockStmt* body, Program* program) {
+    if (!stmt) return;
+    switch (stmt->type) {
+        case AstNodeType::BLOCK_STMT: {
+            BlockStmt* block = static_cast<BlockStmt*>(stmt);
+            for (size_t i = 0; i < block->statements.size(); i++) {
+                collect_stack_vars_stmt(block->statements[i], body, program);
+            }
+            break;
+        }
+
+        case AstNodeType::VAR_DECL: {
+            VarDecl* decl = static_cast<VarDecl*>(stmt);
+            if (_stack_var_count >= MAX_STACK_VARS) return;
+            ClassDecl* cls = class_ctor_call(decl->initializer, program);
+            if (!cls || decl->type_name != cls->name) return;
+            if (class_leaks_this(cls->name, program)) return;
+            if (stmt_escapes_var(body, decl->name)) return;
+            _stack_vars[_stack_var_count++] = decl->name;
+            break;
+        }
+
+        case AstNodeType::IF_STMT: {
+            IfStmt* is = static_cast<IfStmt*>(stmt);
+            collect_stack_vars_stmt(is->then_branch, body, program);
+            collect_stack_vars_stmt(is->else_branch, body, program);
+            break;
+        }
+
+        case AstNodeType::WHILE_STMT:
+            collect_stack_vars_stmt(static_cast<WhileStmt*>(stmt)->body, body, program);
+            break;
+
+        case AstNodeType::FOR_STMT: {
+            ForStmt* fs = static_cast<ForStmt*>(stmt);
+            collect_stack_vars_stmt(fs->initializer, body, program);
+            collect_stack_vars_stmt(fs->body, body, program);
+            break;
+        }
+
+        case AstNodeType::SWITCH_STMT: {
+            SwitchStmt* ss = static_cast<SwitchStmt*>(stmt);
+            for (size_t i = 0; i < ss->cases.size(); i++) {
+                collect_stack_vars_stmt(ss->cases[i]->body, body, program);
+            }
+            break;
+        }
+
+        case AstNodeType::TRY_CATCH_STMT: {
+            TryCatchStmt* tc = static_cast<TryCatchStmt*>(stmt);
+            collect_stack_vars_stmt(tc->try_body, body, program);
+            collect_stack_vars_stmt(tc->catch_body, body, program);
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+void Compiler::collect_stack_vars(BlockStmt* body, Program* program) {
+    _stack_var_count = 0;
+    if (!body) return;
+    collect_stack_vars_stmt(body, body, program);
+}
+
+bool Compiler::is_stack_var(const String& name) {
+    for (int i = 0; i < _stack_var_count; i++) {
+        if (_stack_vars[i] == name) return true;
+    }
+    return false;
+}
+
 FunctionDecl* Compiler::find_method(const String& class_name, const String& method_name, Program* program) {
     for (size_t i = 0; i < program->methods.size(); i++) {
         if (program->methods[i]->class_name == class_name && program->methods[i]->name == method_name) {
@@ -228,18 +513,19 @@ FunctionDecl* Compiler::find_method(const String& class_name, const String& meth
     return nullptr;
 }
 
-CodeBuffer::CodeBuffer() : pos(0), capacity(1048576) {
+CodeBuffer::CodeBuffer(FILE* out_file) : out(out_file), pos(0), capacity(65536) {
     data = (char*)malloc(capacity);
 }
 
 CodeBuffer::~CodeBuffer() {
+    flush();
     free(data);
 }
 
-void CodeBuffer::ensure(int needed) {
-    while (pos + needed >= capacity) {
-        capacity *= 2;
-        data = (char*)realloc(data, capacity);
+void CodeBuffer::flush() {
+    if (pos > 0) {
+        fwrite(data, 1, pos, out);
+        pos = 0;
     }
 }
 
@@ -249,7 +535,15 @@ int CodeBuffer::append(const char* fmt, ...) {
     int needed = vsnprintf(nullptr, 0, fmt, args);
     va_end(args);
 
-    ensure(needed + 1);
+    if (pos + needed + 1 > capacity) {
+        flush();
+        if (needed + 1 > capacity) {
+            va_start(args, fmt);
+            vfprintf(out, fmt, args);
+            va_end(args);
+            return needed;
+        }
+    }
 
     va_start(args, fmt);
     int written = vsnprintf(data + pos, capacity - pos, fmt, args);
@@ -339,6 +633,19 @@ String Compiler::lookup_var_type(const String& name, Program* program) {
 
 String Compiler::infer_expr_type(ExprNode* expr, Program* program) {
     if (!expr) return String("i32");
+    if (!expr->resolved_type.empty()) return expr->resolved_type;
+
+    bool outer_depends = _infer_depends_on_expected;
+    _infer_depends_on_expected = false;
+    String result = compute_expr_type(expr, program);
+    if (!_infer_depends_on_expected && !result.empty()) {
+        expr->resolved_type = result;
+    }
+    _infer_depends_on_expected = _infer_depends_on_expected || outer_depends;
+    return result;
+}
+
+String Compiler::compute_expr_type(ExprNode* expr, Program* program) {
     switch (expr->type) {
         case AstNodeType::INTEGER_LITERAL: return String("i32");
         case AstNodeType::FLOAT_LITERAL: return String("f32");
@@ -435,15 +742,23 @@ String Compiler::infer_expr_type(ExprNode* expr, Program* program) {
                 IdentifierExpr* id = static_cast<IdentifierExpr*>(call->callee);
                 if (id->name == "str_concat" || id->name == "str_substring" ||
                     id->name == "to_str" ||
-                    id->name == "file_read" || id->name == "input") {
+                    id->name == "file_read" || id->name == "file_read_line" ||
+                    id->name == "file_read_chunk" || id->name == "file_mmap" ||
+                    id->name == "input") {
                     return String("str");
                 }
                 if (id->name == "str_index_of" ||
                     id->name == "str_compare" || id->name == "str_length") {
                     return String("i32");
                 }
-                if (id->name == "parse") return _expected_type.length() > 0 ? _expected_type : String("i64");
+                if (id->name == "parse") {
+                    _infer_depends_on_expected = true;
+                    return _expected_type.length() > 0 ? _expected_type : String("i64");
+                }
                 if (id->name == "file_exists") return String("b8");
+                if (id->name == "file_read_async" || id->name == "file_write_async") {
+                    return String("void");
+                }
                 if (id->name == "sqrt" || id->name == "sin" || id->name == "cos" ||
                     id->name == "tan" || id->name == "pow" || id->name == "floor" ||
                     id->name == "ceil" || id->name == "round" || id->name == "log" ||
@@ -486,7 +801,8 @@ String Compiler::infer_expr_type(ExprNode* expr, Program* program) {
             if (call->callee->type == AstNodeType::MEMBER_EXPR) {
                 MemberExpr* me = static_cast<MemberExpr*>(call->callee);
                 if (me->member == "length") return String("i32");
-                if (me->member == "push") return String("void");
+                if (me->member == "push" || me->member == "reserve" ||
+                    me->member == "append") return String("void");
                 if (me->member == "pop") {
                     String arr_type = infer_expr_type(me->object, program);
                     if (is_array_type_str(arr_type)) {
@@ -498,6 +814,25 @@ String Compiler::infer_expr_type(ExprNode* expr, Program* program) {
                     return String("str");
                 }
                 if (me->member == "recv") return String("i32");
+                if (me->member == "emit_n") return String("void");
+                if (me->member == "recv_n") {
+                    ExprNode* sig_obj = me->object;
+                    if (sig_obj->type == AstNodeType::INDEX_EXPR) {
+                        sig_obj = static_cast<IndexExpr*>(sig_obj)->array;
+                    }
+                    if (sig_obj->type == AstNodeType::IDENTIFIER_EXPR) {
+                        IdentifierExpr* sig_id = static_cast<IdentifierExpr*>(sig_obj);
+                        for (size_t i = 0; i < program->signals.size(); i++) {
+                            if (program->signals[i]->name == sig_id->name) {
+                                char arr_type[140];
+                                snprintf(arr_type, sizeof(arr_type), "%s[]",
+                                    program->signals[i]->type_param.c_str());
+                                return String(arr_type);
+                            }
+                        }
+                    }
+                    return String("i32[]");
+                }
             }
             return String("i32");
         }
@@ -702,37 +1037,36 @@ void Compiler::generate_typed_decl(CodeBuffer& buf, const String& tick_type, con
 }
 
 bool Compiler::compile_to_native(const char* source_file, const char* output_file, bool keep_c) {
-    FILE* f = fopen(source_file, "r");
-    if (!f) {
+    double t_start = time_now_ms();
+
+    SourceFile source;
+    if (!SourceLoader::load(source_file, &source)) {
         fprintf(stderr, "Error: Cannot open %s\n", source_file);
         return false;
     }
+    double t_load = time_now_ms();
 
-    fseek(f, 0, SEEK_END);
-    long size = ftell(f);
-    fseek(f, 0, SEEK_SET);
-
-    char* source = (char*)malloc(size + 1);
-    fread(source, 1, size, f);
-    source[size] = '\0';
-    fclose(f);
-
-    Lexer lexer(source);
+    Lexer lexer(source.data);
     DynamicArray<Token> tokens = lexer.tokenize();
+    double t_lex = time_now_ms();
 
     Parser parser(tokens);
     for (int i = 0; i < _define_count; i++) {
         parser.add_define(_defines[i]);
     }
     Program* program = parser.parse();
+    double t_parse = time_now_ms();
 
     if (!program) {
         fprintf(stderr, "Parse error\n");
-        free(source);
+        SourceLoader::unload(&source);
         return false;
     }
 
     ModuleLoader module_loader;
+    module_loader.preload(program, source_file);
+    double t_modules = time_now_ms();
+
     SemanticAnalyzer analyzer;
     analyzer.set_module_loader(&module_loader);
     analyzer.set_current_file_path(source_file);
@@ -740,20 +1074,36 @@ bool Compiler::compile_to_native(const char* source_file, const char* output_fil
     if (!analyzer.analyze(program)) {
         fprintf(stderr, "Semantic analysis failed\n");
         delete program;
-        free(source);
+        SourceLoader::unload(&source);
         return false;
     }
+    double t_sema = time_now_ms();
 
-    String c_code = generate_c_code(program);
+    Optimizer optimizer;
+    optimizer.optimize(program);
+    double t_opt = time_now_ms();
 
     char temp_c[256];
+    if (_profile == BuildProfile::PGO_GENERATE || _profile == BuildProfile::PGO_USE) {
+        keep_c = true;
+    }
     if (keep_c) {
         snprintf(temp_c, sizeof(temp_c), "%s.c", output_file);
     } else {
         snprintf(temp_c, sizeof(temp_c), "/tmp/tick_%d.c", getpid());
     }
 
-    write_to_file(temp_c, c_code.c_str());
+    FILE* c_out = fopen(temp_c, "w");
+    if (!c_out) {
+        fprintf(stderr, "Error: Cannot write %s\n", temp_c);
+        delete program;
+        SourceLoader::unload(&source);
+        return false;
+    }
+    generate_c_code(program, c_out);
+    long c_bytes = ftell(c_out);
+    fclose(c_out);
+    double t_codegen = time_now_ms();
 
     char extra_flags[2048] = {0};
     size_t flags_offset = 0;
@@ -763,6 +1113,43 @@ bool Compiler::compile_to_native(const char* source_file, const char* output_fil
     }
 
     bool success = invoke_gcc(temp_c, output_file, extra_flags);
+    double t_gcc = time_now_ms();
+
+    if (_time_report) {
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        double load_ms = t_load - t_start;
+        double lex_ms = t_lex - t_load;
+        double parse_ms = t_parse - t_lex;
+        double modules_ms = t_modules - t_parse;
+        double sema_ms = t_sema - t_modules;
+        double opt_ms = t_opt - t_sema;
+        double codegen_ms = t_codegen - t_opt;
+        double gcc_ms = t_gcc - t_codegen;
+        double total_ms = t_gcc - t_start;
+        fprintf(stderr, "=== Time Report: %s ===\n", source_file);
+        fprintf(stderr, "  load     %8.2f ms\n", load_ms);
+        fprintf(stderr, "  lex      %8.2f ms\n", lex_ms);
+        fprintf(stderr, "  parse    %8.2f ms\n", parse_ms);
+        fprintf(stderr, "  modules  %8.2f ms\n", modules_ms);
+        fprintf(stderr, "  sema     %8.2f ms\n", sema_ms);
+        fprintf(stderr, "  opt      %8.2f ms\n", opt_ms);
+        fprintf(stderr, "  codegen  %8.2f ms\n", codegen_ms);
+        fprintf(stderr, "  gcc      %8.2f ms\n", gcc_ms);
+        fprintf(stderr, "  total    %8.2f ms\n", total_ms);
+        fprintf(stderr, "  source %zu bytes, %zu tokens, ast arena %zu bytes\n",
+            source.size, tokens.size(), program->arena.bytes_allocated());
+        fprintf(stderr, "  modules loaded %zu, generated C %ld bytes, peak rss %ld KB\n",
+            module_loader.loaded_module_count(), c_bytes, usage.ru_maxrss);
+        fprintf(stderr,
+            "{\"file\":\"%s\",\"load_ms\":%.3f,\"lex_ms\":%.3f,\"parse_ms\":%.3f,"
+            "\"modules_ms\":%.3f,\"sema_ms\":%.3f,\"opt_ms\":%.3f,\"codegen_ms\":%.3f,\"gcc_ms\":%.3f,"
+            "\"total_ms\":%.3f,\"source_bytes\":%zu,\"tokens\":%zu,\"arena_bytes\":%zu,"
+            "\"modules\":%zu,\"c_bytes\":%ld,\"peak_rss_kb\":%ld}\n",
+            source_file, load_ms, lex_ms, parse_ms, modules_ms, sema_ms, opt_ms, codegen_ms,
+            gcc_ms, total_ms, source.size, tokens.size(), program->arena.bytes_allocated(),
+            module_loader.loaded_module_count(), c_bytes, usage.ru_maxrss);
+    }
 
     if (success && !keep_c) {
         remove(temp_c);
@@ -773,13 +1160,21 @@ bool Compiler::compile_to_native(const char* source_file, const char* output_fil
     }
 
     delete program;
-    free(source);
+    SourceLoader::unload(&source);
 
     return success;
 }
 
-String Compiler::generate_c_code(Program* program) {
-    CodeBuffer buf;
+bool Compiler::generate_c_to_file(Program* program, const char* path) {
+    FILE* out = fopen(path, "w");
+    if (!out) return false;
+    generate_c_code(program, out);
+    fclose(out);
+    return true;
+}
+
+void Compiler::generate_c_code(Program* program, FILE* out) {
+    CodeBuffer buf(out);
 
     buf.append("#include <stdio.h>\n");
     buf.append("#include <stdlib.h>\n");
@@ -1004,6 +1399,7 @@ String Compiler::generate_c_code(Program* program) {
 
         _current_func = method;
         _current_class = cls;
+        collect_stack_vars(method->body, program);
 
         if (method->body) {
             for (size_t k = 0; k < method->body->statements.size(); k++) {
@@ -1020,15 +1416,20 @@ String Compiler::generate_c_code(Program* program) {
         buf.append("}\n\n");
     }
 
-    String result(buf.data, buf.pos);
-    return result;
+    buf.flush();
 }
 
 void Compiler::generate_process(CodeBuffer& buf, ProcessDecl* proc, Program* program) {
     buf.append("void* %s(void* arg) {\n", mangle(proc->name).c_str());
 
+    if (_profiling) {
+        buf.append("    static TickProfCounter __prof_counter = { \"%s\" };\n", proc->name.c_str());
+        buf.append("    TickProfScope __prof_scope __attribute__((cleanup(tick_prof_scope_end))) = tick_prof_scope_begin(&__prof_counter);\n");
+    }
+
     _current_process = proc;
     _current_func = nullptr;
+    collect_stack_vars(proc->body, program);
     push_defer_scope();
     for (size_t i = 0; i < proc->body->statements.size(); i++) {
         generate_statement(buf, proc->body->statements[i], 1, program);
@@ -1047,6 +1448,7 @@ void Compiler::generate_function(CodeBuffer& buf, FunctionDecl* func, Program* p
 
     _current_func = func;
     _current_class = nullptr;
+    collect_stack_vars(func->body, program);
 
     buf.append("%s %s(", ret_type, mangle(func->name).c_str());
     for (size_t j = 0; j < func->parameters.size(); j++) {
@@ -1059,9 +1461,17 @@ void Compiler::generate_function(CodeBuffer& buf, FunctionDecl* func, Program* p
     }
     buf.append(") {\n");
 
+    if (_profiling) {
+        buf.append("    static TickProfCounter __prof_counter = { \"%s\" };\n", func->name.c_str());
+        buf.append("    TickProfScope __prof_scope __attribute__((cleanup(tick_prof_scope_end))) = tick_prof_scope_begin(&__prof_counter);\n");
+    }
+
     push_defer_scope();
 
     if (func->name == "main") {
+        if (_profiling) {
+            buf.append("    tick_prof_enable();\n");
+        }
         for (size_t i = 0; i < program->globals.size(); i++) {
             VarDecl* var = program->globals[i];
             bool is_arr = var->type_name.length() > 2 &&
@@ -1095,9 +1505,17 @@ void Compiler::generate_function(CodeBuffer& buf, FunctionDecl* func, Program* p
             if (sig->array_size > 0) {
                 buf.append("    for (int _i = 0; _i < %d; _i++) {\n", sig->array_size);
                 buf.append("        tick_signal_init(&%s[_i]);\n", sig->name.c_str());
+                if (_profiling) {
+                    buf.append("        tick_prof_register_signal(&%s[_i], \"%s\");\n",
+                        sig->name.c_str(), sig->name.c_str());
+                }
                 buf.append("    }\n");
             } else {
                 buf.append("    tick_signal_init(&%s);\n", sig->name.c_str());
+                if (_profiling) {
+                    buf.append("    tick_prof_register_signal(&%s, \"%s\");\n",
+                        sig->name.c_str(), sig->name.c_str());
+                }
             }
         }
 
@@ -1170,6 +1588,44 @@ void Compiler::generate_statement(CodeBuffer& buf, StmtNode* stmt, int indent, P
                 buf.append(";\n");
             } else if (is_array) {
                 buf.append("TickArray %s = {0};\n", decl->name.c_str());
+            } else if (!decl->is_const && is_stack_var(decl->name) &&
+                       class_ctor_call(decl->initializer, program) &&
+                       class_ctor_call(decl->initializer, program)->name == decl->type_name) {
+                ClassDecl* cls = class_ctor_call(decl->initializer, program);
+                CallExpr* call = static_cast<CallExpr*>(decl->initializer);
+                buf.append("%s __%s_storage; memset(&__%s_storage, 0, sizeof(%s));\n",
+                    cls->name.c_str(), decl->name.c_str(), decl->name.c_str(), cls->name.c_str());
+
+                FunctionDecl* constructor = nullptr;
+                for (size_t i = 0; i < program->methods.size(); i++) {
+                    if (program->methods[i]->class_name == cls->name &&
+                        program->methods[i]->name == cls->name &&
+                        !program->methods[i]->is_destructor) {
+                        constructor = program->methods[i];
+                        break;
+                    }
+                }
+                if (constructor) {
+                    for (int i = 0; i < indent; i++) buf.append("    ");
+                    buf.append("%s_%s(&__%s_storage", cls->name.c_str(), constructor->name.c_str(),
+                        decl->name.c_str());
+                    for (size_t i = 0; i < call->arguments.size(); i++) {
+                        buf.append(", ");
+                        generate_expression(buf, call->arguments[i], program);
+                    }
+                    buf.append(");\n");
+                }
+                for (int i = 0; i < indent; i++) buf.append("    ");
+                buf.append("%s* %s = &__%s_storage;\n", cls->name.c_str(), decl->name.c_str(),
+                    decl->name.c_str());
+
+                if (class_has_destructor(decl->type_name, program) && _defer_depth >= 0 &&
+                    _raii_counts[_defer_depth] < MAX_RAII_PER_SCOPE) {
+                    _raii_scopes[_defer_depth][_raii_counts[_defer_depth]].var_name = decl->name;
+                    _raii_scopes[_defer_depth][_raii_counts[_defer_depth]].class_name = decl->type_name;
+                    _raii_scopes[_defer_depth][_raii_counts[_defer_depth]].on_stack = true;
+                    _raii_counts[_defer_depth]++;
+                }
             } else {
                 generate_typed_decl(buf, decl->type_name, decl->name.c_str(), program);
                 if (decl->initializer) {
@@ -1201,6 +1657,7 @@ void Compiler::generate_statement(CodeBuffer& buf, StmtNode* stmt, int indent, P
                     _raii_counts[_defer_depth] < MAX_RAII_PER_SCOPE) {
                     _raii_scopes[_defer_depth][_raii_counts[_defer_depth]].var_name = decl->name;
                     _raii_scopes[_defer_depth][_raii_counts[_defer_depth]].class_name = decl->type_name;
+                    _raii_scopes[_defer_depth][_raii_counts[_defer_depth]].on_stack = false;
                     _raii_counts[_defer_depth]++;
                 }
             }
@@ -1637,11 +2094,30 @@ void Compiler::generate_expression(CodeBuffer& buf, ExprNode* expr, Program* pro
             String right_type = infer_expr_type(bin->right, program);
 
             if (bin->op == "+" && (left_type == "str" || right_type == "str")) {
-                buf.append("tick_str_concat(");
-                generate_expression(buf, bin->left, program);
-                buf.append(", ");
-                generate_expression(buf, bin->right, program);
-                buf.append(")");
+                ExprNode* parts[16];
+                int part_count = 0;
+                ExprNode* node = expr;
+                while (node->type == AstNodeType::BINARY_EXPR && part_count < 15) {
+                    BinaryExpr* chain = static_cast<BinaryExpr*>(node);
+                    if (chain->op != "+" || infer_expr_type(chain->right, program) != "str") break;
+                    parts[part_count++] = chain->right;
+                    node = chain->left;
+                }
+                if (part_count >= 2 && infer_expr_type(node, program) == "str") {
+                    parts[part_count++] = node;
+                    buf.append("({ const char* __cat[%d] = { ", part_count);
+                    for (int i = part_count - 1; i >= 0; i--) {
+                        generate_expression(buf, parts[i], program);
+                        if (i > 0) buf.append(", ");
+                    }
+                    buf.append(" }; tick_str_concat_n(__cat, %d); })", part_count);
+                } else {
+                    buf.append("tick_str_concat(");
+                    generate_expression(buf, bin->left, program);
+                    buf.append(", ");
+                    generate_expression(buf, bin->right, program);
+                    buf.append(")");
+                }
             } else if (bin->op == "==" && left_type == "str" && right_type == "str") {
                 buf.append("(tick_str_compare(");
                 generate_expression(buf, bin->left, program);
@@ -1857,6 +2333,61 @@ void Compiler::generate_expression(CodeBuffer& buf, ExprNode* expr, Program* pro
                             buf.append("tick_signal_recv(&%s)", obj->name.c_str());
                         }
                     }
+                } else if (member->member == "emit_n" || member->member == "recv_n") {
+                    String signal_name;
+                    ExprNode* signal_index = nullptr;
+
+                    if (member->object->type == AstNodeType::INDEX_EXPR) {
+                        IndexExpr* idx_expr = static_cast<IndexExpr*>(member->object);
+                        IdentifierExpr* obj = static_cast<IdentifierExpr*>(idx_expr->array);
+                        signal_name = obj->name;
+                        signal_index = idx_expr->index;
+                    } else {
+                        IdentifierExpr* obj = static_cast<IdentifierExpr*>(member->object);
+                        signal_name = obj->name;
+                    }
+
+                    String signal_type;
+                    for (size_t i = 0; i < program->signals.size(); i++) {
+                        if (program->signals[i]->name == signal_name) {
+                            signal_type = program->signals[i]->type_param;
+                            break;
+                        }
+                    }
+
+                    bool is_pointer_type = false;
+                    for (size_t i = 0; i < program->classes.size(); i++) {
+                        if (program->classes[i]->name == signal_type) {
+                            is_pointer_type = true;
+                            break;
+                        }
+                    }
+
+                    char c_base[128];
+                    tick_type_to_c_type(signal_type, program, c_base, sizeof(c_base));
+                    const char* value_cast = is_pointer_type ? "" : "(intptr_t)";
+
+                    if (member->member == "emit_n") {
+                        buf.append("({ TickArray __eb = ");
+                        if (call->arguments.size() > 0) generate_expression(buf, call->arguments[0], program);
+                        buf.append("; void** __ev = (void**)malloc(sizeof(void*) * (size_t)__eb.len); for (int32_t __i = 0; __i < __eb.len; __i++) __ev[__i] = (void*)%s((%s*)__eb.ptr)[__i]; tick_signal_emit_n(&%s", value_cast, c_base, signal_name.c_str());
+                        if (signal_index) {
+                            buf.append("[");
+                            generate_expression(buf, signal_index, program);
+                            buf.append("]");
+                        }
+                        buf.append(", __ev, __eb.len); free(__ev); })");
+                    } else {
+                        buf.append("({ int32_t __n = (int32_t)(");
+                        if (call->arguments.size() > 0) generate_expression(buf, call->arguments[0], program);
+                        buf.append("); void** __rvs = (void**)malloc(sizeof(void*) * (size_t)__n); tick_signal_recv_n(&%s", signal_name.c_str());
+                        if (signal_index) {
+                            buf.append("[");
+                            generate_expression(buf, signal_index, program);
+                            buf.append("]");
+                        }
+                        buf.append(", __rvs, __n); TickArray __rb; __rb.len = __n; __rb.cap = __n; __rb.ptr = malloc(sizeof(%s) * (size_t)__n); for (int32_t __i = 0; __i < __n; __i++) ((%s*)__rb.ptr)[__i] = (%s)%s__rvs[__i]; free(__rvs); __rb; })", c_base, c_base, c_base, value_cast);
+                    }
                 } else if (member->member == "execute") {
                     IdentifierExpr* obj = static_cast<IdentifierExpr*>(member->object);
                     buf.append("tick_event_execute(&%s)", obj->name.c_str());
@@ -1898,6 +2429,32 @@ void Compiler::generate_expression(CodeBuffer& buf, ExprNode* expr, Program* pro
                         generate_expression(buf, call->arguments[0], program);
                         buf.append(")");
                     }
+                } else if ((member->member == "reserve" || member->member == "append") &&
+                           call->arguments.size() == 1) {
+                    String obj_type = infer_expr_type(member->object, program);
+                    if (is_array_type_str(obj_type) && member->object->type == AstNodeType::IDENTIFIER_EXPR) {
+                        IdentifierExpr* obj_id = static_cast<IdentifierExpr*>(member->object);
+                        String base_type(obj_type.c_str(), obj_type.length() - 2);
+                        char c_base[128];
+                        tick_type_to_c_type(base_type, program, c_base, sizeof(c_base));
+                        bool is_param = is_array_param(obj_id->name);
+                        const char* addr = is_param ? "" : "&";
+                        if (member->member == "reserve") {
+                            buf.append("tick_array_reserve(%s%s, sizeof(%s), ", addr, obj_id->name.c_str(), c_base);
+                            generate_expression(buf, call->arguments[0], program);
+                            buf.append(")");
+                        } else {
+                            buf.append("({ TickArray __ap = ");
+                            generate_expression(buf, call->arguments[0], program);
+                            buf.append("; tick_array_append_n(%s%s, sizeof(%s), __ap.ptr, __ap.len); })",
+                                addr, obj_id->name.c_str(), c_base);
+                        }
+                    } else {
+                        generate_expression(buf, call->callee, program);
+                        buf.append("(");
+                        generate_expression(buf, call->arguments[0], program);
+                        buf.append(")");
+                    }
                 } else if (member->member == "pop" && call->arguments.size() == 0) {
                     String obj_type = infer_expr_type(member->object, program);
                     if (is_array_type_str(obj_type) && member->object->type == AstNodeType::IDENTIFIER_EXPR) {
@@ -2164,6 +2721,27 @@ void Compiler::generate_expression(CodeBuffer& buf, ExprNode* expr, Program* pro
                         generate_expression(buf, call->arguments[i], program);
                     }
                     buf.append(")");
+                } else if (ident->name == "file_read_line") {
+                    buf.append("tick_file_read_line(");
+                    for (size_t i = 0; i < call->arguments.size(); i++) {
+                        if (i > 0) buf.append(", ");
+                        generate_expression(buf, call->arguments[i], program);
+                    }
+                    buf.append(")");
+                } else if (ident->name == "file_read_chunk") {
+                    buf.append("tick_file_read_chunk(");
+                    for (size_t i = 0; i < call->arguments.size(); i++) {
+                        if (i > 0) buf.append(", ");
+                        generate_expression(buf, call->arguments[i], program);
+                    }
+                    buf.append(")");
+                } else if (ident->name == "file_mmap") {
+                    buf.append("tick_file_mmap(");
+                    for (size_t i = 0; i < call->arguments.size(); i++) {
+                        if (i > 0) buf.append(", ");
+                        generate_expression(buf, call->arguments[i], program);
+                    }
+                    buf.append(")");
                 } else if (ident->name == "file_write") {
                     buf.append("tick_file_write(");
                     for (size_t i = 0; i < call->arguments.size(); i++) {
@@ -2178,6 +2756,24 @@ void Compiler::generate_expression(CodeBuffer& buf, ExprNode* expr, Program* pro
                         generate_expression(buf, call->arguments[i], program);
                     }
                     buf.append(")");
+                } else if (ident->name == "file_read_async" || ident->name == "file_write_async") {
+                    buf.append("tick_%s(", ident->name.c_str());
+                    for (size_t i = 0; i < call->arguments.size(); i++) {
+                        if (i > 0) buf.append(", ");
+                        bool is_signal_arg = false;
+                        if (call->arguments[i]->type == AstNodeType::IDENTIFIER_EXPR) {
+                            IdentifierExpr* arg_id = static_cast<IdentifierExpr*>(call->arguments[i]);
+                            for (size_t j = 0; j < program->signals.size(); j++) {
+                                if (program->signals[j]->name == arg_id->name) {
+                                    is_signal_arg = true;
+                                    break;
+                                }
+                            }
+                        }
+                        if (is_signal_arg) buf.append("&");
+                        generate_expression(buf, call->arguments[i], program);
+                    }
+                    buf.append(")");
                 } else if (ident->name == "file_exists") {
                     buf.append("tick_file_exists(");
                     for (size_t i = 0; i < call->arguments.size(); i++) {
@@ -2343,14 +2939,6 @@ void Compiler::generate_expression(CodeBuffer& buf, ExprNode* expr, Program* pro
     }
 }
 
-void Compiler::write_to_file(const char* filename, const char* content) {
-    FILE* f = fopen(filename, "w");
-    if (f) {
-        fprintf(f, "%s", content);
-        fclose(f);
-    }
-}
-
 bool Compiler::invoke_gcc(const char* c_file, const char* output_file, const char* extra_flags) {
     char cmd[2048];
     char exe_path[1024];
@@ -2397,9 +2985,176 @@ bool Compiler::invoke_gcc(const char* c_file, const char* output_file, const cha
         snprintf(include_path, sizeof(include_path), "-I%s/../share/tick", exe_path);
     }
 
-    snprintf(cmd, sizeof(cmd), "gcc -O2 -o %s %s %s -pthread -lm %s %s",
-        output_file, c_file, runtime_path, include_path, extra_flags ? extra_flags : "");
+    char opt_flags[1152];
+    switch (_profile) {
+        case BuildProfile::FAST:
+            snprintf(opt_flags, sizeof(opt_flags), "-O0 -pipe");
+            break;
+        case BuildProfile::RELEASE:
+            snprintf(opt_flags, sizeof(opt_flags), "-O3 -flto -march=native");
+            break;
+        case BuildProfile::PGO_GENERATE: {
+            char profile_dir[1088];
+            snprintf(profile_dir, sizeof(profile_dir), "%s.pgo", output_file);
+            mkdir(profile_dir, 0755);
+            snprintf(opt_flags, sizeof(opt_flags),
+                "-O3 -march=native -fprofile-generate=%s", profile_dir);
+            break;
+        }
+        case BuildProfile::PGO_USE:
+            snprintf(opt_flags, sizeof(opt_flags),
+                "-O3 -march=native -fprofile-use=%s.pgo -fprofile-correction", output_file);
+            break;
+        default:
+            snprintf(opt_flags, sizeof(opt_flags), "-O2");
+            break;
+    }
+
+    bool whole_program = _profile == BuildProfile::RELEASE ||
+        _profile == BuildProfile::PGO_GENERATE || _profile == BuildProfile::PGO_USE;
+
+    char runtime_archive[1024];
+    bool have_archive = !whole_program &&
+        find_runtime_archive(exe_path, runtime_path, runtime_archive, sizeof(runtime_archive));
+
+    char cache_dir[1024];
+    if (whole_program || !object_cache_dir(cache_dir, sizeof(cache_dir))) {
+        snprintf(cmd, sizeof(cmd), "gcc %s -o %s %s %s -pthread -lm %s %s",
+            opt_flags, output_file, c_file,
+            have_archive ? runtime_archive : runtime_path,
+            include_path, extra_flags ? extra_flags : "");
+        return system(cmd) == 0;
+    }
+
+    char runtime_header[1024];
+    strncpy(runtime_header, runtime_path, sizeof(runtime_header) - 1);
+    runtime_header[sizeof(runtime_header) - 1] = '\0';
+    size_t header_len = strlen(runtime_header);
+    if (header_len > 0) runtime_header[header_len - 1] = 'h';
+
+    uint64_t program_hash = hash_file(c_file);
+    uint64_t header_hash = hash_file(runtime_header);
+    uint64_t runtime_hash = hash_file(runtime_path);
+    if (program_hash == 0 || header_hash == 0 || runtime_hash == 0) {
+        snprintf(cmd, sizeof(cmd), "gcc %s -o %s %s %s -pthread -lm %s %s",
+            opt_flags, output_file, c_file, runtime_path, include_path,
+            extra_flags ? extra_flags : "");
+        return system(cmd) == 0;
+    }
+
+    program_hash ^= header_hash * 0x9e3779b97f4a7c15ull;
+
+    char program_obj[1280];
+    snprintf(program_obj, sizeof(program_obj), "%s/tick_%016llx%s.o",
+        cache_dir, (unsigned long long)program_hash,
+        _profile == BuildProfile::FAST ? "_fast" : "");
+    if (access(program_obj, F_OK) != 0) {
+        char temp_obj[1344];
+        snprintf(temp_obj, sizeof(temp_obj), "%s.%d.tmp", program_obj, getpid());
+        snprintf(cmd, sizeof(cmd), "gcc %s -c %s -o %s %s", opt_flags, c_file, temp_obj, include_path);
+        if (system(cmd) != 0) {
+            remove(temp_obj);
+            return false;
+        }
+        if (rename(temp_obj, program_obj) != 0) {
+            remove(temp_obj);
+            return false;
+        }
+    }
+
+    if (have_archive) {
+        snprintf(cmd, sizeof(cmd), "gcc -o %s %s %s -pthread -lm %s",
+            output_file, program_obj, runtime_archive, extra_flags ? extra_flags : "");
+        return system(cmd) == 0;
+    }
+
+    runtime_hash ^= header_hash * 0x9e3779b97f4a7c15ull;
+
+    char runtime_obj[1280];
+    snprintf(runtime_obj, sizeof(runtime_obj), "%s/runtime_%016llx.o",
+        cache_dir, (unsigned long long)runtime_hash);
+    if (access(runtime_obj, F_OK) != 0) {
+        char temp_obj[1344];
+        snprintf(temp_obj, sizeof(temp_obj), "%s.%d.tmp", runtime_obj, getpid());
+        snprintf(cmd, sizeof(cmd), "gcc -O2 -c %s -o %s", runtime_path, temp_obj);
+        if (system(cmd) != 0) {
+            remove(temp_obj);
+            return false;
+        }
+        if (rename(temp_obj, runtime_obj) != 0) {
+            remove(temp_obj);
+            return false;
+        }
+    }
+
+    snprintf(cmd, sizeof(cmd), "gcc -o %s %s %s -pthread -lm %s",
+        output_file, program_obj, runtime_obj, extra_flags ? extra_flags : "");
+    return system(cmd) == 0;
+}
+
+bool Compiler::find_runtime_archive(const char* exe_path, const char* runtime_path,
+                                    char* out, size_t out_size) {
+    char candidates[2][1024];
+    snprintf(candidates[0], sizeof(candidates[0]), "%s/libtickrt.a", exe_path);
+    snprintf(candidates[1], sizeof(candidates[1]), "%s/../lib/libtickrt.a", exe_path);
+
+    struct stat archive_st;
+    const char* found = nullptr;
+    for (int i = 0; i < 2; i++) {
+        if (stat(candidates[i], &archive_st) == 0) {
+            found = candidates[i];
+            break;
+        }
+    }
+    if (!found) return false;
+
+    char runtime_header[1024];
+    strncpy(runtime_header, runtime_path, sizeof(runtime_header) - 1);
+    runtime_header[sizeof(runtime_header) - 1] = '\0';
+    size_t header_len = strlen(runtime_header);
+    if (header_len > 0) runtime_header[header_len - 1] = 'h';
+
+    struct stat src_st;
+    if (stat(runtime_path, &src_st) == 0 && src_st.st_mtime > archive_st.st_mtime) {
+        return false;
+    }
+    if (stat(runtime_header, &src_st) == 0 && src_st.st_mtime > archive_st.st_mtime) {
+        return false;
+    }
 
-    int result = system(cmd);
-    return result == 0;
+    strncpy(out, found, out_size - 1);
+    out[out_size - 1] = '\0';
+    return true;
+}
+
+uint64_t Compiler::hash_file(const char* path) {
+    SourceFile file;
+    if (!SourceLoader::load(path, &file)) {
+        return 0;
+    }
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < file.size; i++) {
+        hash ^= (unsigned char)file.data[i];
+        hash *= 1099511628211ull;
+    }
+    SourceLoader::unload(&file);
+    return hash ? hash : 1;
+}
+
+bool Compiler::object_cache_dir(char* buf, size_t buf_size) {
+    const char* home = getenv("HOME");
+    if (home && home[0] != '\0') {
+        char parent[896];
+        snprintf(parent, sizeof(parent), "%s/.cache", home);
+        mkdir(parent, 0755);
+        snprintf(parent, sizeof(parent), "%s/.cache/tick", home);
+        mkdir(parent, 0755);
+        snprintf(buf, buf_size, "%s/.cache/tick/obj", home);
+    } else {
+        snprintf(buf, buf_size, "/tmp/tick-obj-%d", (int)getuid());
+    }
+    if (mkdir(buf, 0755) != 0 && errno != EEXIST) {
+        return false;
+    }
+    return access(buf, W_OK) == 0;
 }
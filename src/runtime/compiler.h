@@ -3,26 +3,30 @@
 #include "../compiler/ast.h"
 #include "../core/string.h"
 #include <cstdio>
+#include <cstdint>
 
 #define MAX_DEFER_SCOPES 64
 #define MAX_DEFERS_PER_SCOPE 64
 #define MAX_RAII_PER_SCOPE 32
 #define MAX_ARRAYS_PER_SCOPE 64
+#define MAX_STACK_VARS 128
 #define MAX_LOOP_DEPTH 32
 
 struct RaiiEntry {
     Tick::String var_name;
     Tick::String class_name;
+    bool on_stack;
 };
 
 struct CodeBuffer {
+    FILE* out;
     char* data;
     int pos;
     int capacity;
 
-    CodeBuffer();
+    CodeBuffer(FILE* out_file);
     ~CodeBuffer();
-    void ensure(int needed);
+    void flush();
     int append(const char* fmt, ...);
 };
 
@@ -30,6 +34,18 @@ class Compiler {
 public:
     static bool compile_to_native(const char* source_file, const char* output_file, bool keep_c = false);
     static void add_define(const char* name);
+
+    enum class BuildProfile {
+        DEFAULT,
+        FAST,
+        RELEASE,
+        PGO_GENERATE,
+        PGO_USE
+    };
+    static void set_build_profile(BuildProfile profile);
+    static void set_time_report(bool enabled);
+    static void set_profiling(bool enabled);
+    static bool generate_c_to_file(Tick::Program* program, const char* path);
     
 private:
     static Tick::FunctionDecl* _current_func;
@@ -37,18 +53,24 @@ private:
     static Tick::ProcessDecl* _current_process;
     static char _defines[64][128];
     static int _define_count;
+    static BuildProfile _profile;
+    static bool _time_report;
+    static bool _profiling;
     static Tick::StmtNode* _defer_scopes[MAX_DEFER_SCOPES][MAX_DEFERS_PER_SCOPE];
     static int _defer_counts[MAX_DEFER_SCOPES];
     static int _defer_depth;
     static Tick::String _expected_type;
+    static bool _infer_depends_on_expected;
     static RaiiEntry _raii_scopes[MAX_DEFER_SCOPES][MAX_RAII_PER_SCOPE];
     static int _raii_counts[MAX_DEFER_SCOPES];
     static Tick::String _array_scopes[MAX_DEFER_SCOPES][MAX_ARRAYS_PER_SCOPE];
     static int _array_counts[MAX_DEFER_SCOPES];
+    static Tick::String _stack_vars[MAX_STACK_VARS];
+    static int _stack_var_count;
     static int _loop_scope_stack[MAX_LOOP_DEPTH];
     static int _loop_depth;
 
-    static Tick::String generate_c_code(Tick::Program* program);
+    static void generate_c_code(Tick::Program* program, FILE* out);
     static void generate_process(CodeBuffer& buf, Tick::ProcessDecl* proc, Tick::Program* program);
     static void generate_function(CodeBuffer& buf, Tick::FunctionDecl* func, Tick::Program* program);
     static void generate_statement(CodeBuffer& buf, Tick::StmtNode* stmt, int indent, Tick::Program* program);
@@ -62,10 +84,19 @@ private:
     static void push_defer_scope();
     static void pop_defer_scope();
     static bool class_has_destructor(const Tick::String& class_name, Tick::Program* program);
+    static void collect_stack_vars(Tick::BlockStmt* body, Tick::Program* program);
+    static void collect_stack_vars_stmt(Tick::StmtNode* stmt, Tick::BlockStmt* body, Tick::Program* program);
+    static bool stmt_escapes_var(Tick::StmtNode* stmt, const Tick::String& name);
+    static bool expr_escapes_var(Tick::ExprNode* expr, const Tick::String& name);
+    static bool is_stack_var(const Tick::String& name);
+    static bool class_leaks_this(const Tick::String& class_name, Tick::Program* program);
+    static Tick::ClassDecl* class_ctor_call(Tick::ExprNode* expr, Tick::Program* program);
     static Tick::ClassDecl* find_class(const Tick::String& name, Tick::Program* program);
     static Tick::FunctionDecl* find_method(const Tick::String& class_name, const Tick::String& method_name, Tick::Program* program);
-    static void write_to_file(const char* filename, const char* content);
     static bool invoke_gcc(const char* c_file, const char* output_file, const char* extra_flags);
+    static bool find_runtime_archive(const char* exe_path, const char* runtime_path, char* out, size_t out_size);
+    static uint64_t hash_file(const char* path);
+    static bool object_cache_dir(char* buf, size_t buf_size);
     static void tick_type_to_c_type(const Tick::String& tick_type, Tick::Program* program, char* out, size_t out_size);
     static bool is_typed_ptr_type(const Tick::String& t);
     static Tick::String typed_ptr_base_type(const Tick::String& t);
@@ -77,6 +108,7 @@ private:
     static Tick::String lookup_var_type(const Tick::String& name, Tick::Program* program);
     static void lookup_var_type_in_block(const Tick::String& name, Tick::BlockStmt* block, Tick::String& result);
     static Tick::String infer_expr_type(Tick::ExprNode* expr, Tick::Program* program);
+    static Tick::String compute_expr_type(Tick::ExprNode* expr, Tick::Program* program);
     static bool is_string_type(Tick::ExprNode* expr, Tick::Program* program);
     static bool is_array_type_str(const Tick::String& t);
     static bool is_array_param(const Tick::String& name);
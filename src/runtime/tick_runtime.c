@@ -1,56 +1,326 @@
 #include "tick_runtime.h"
+#include <fcntl.h>
+#include <sched.h>
 #include <stdlib.h>
+#include <unistd.h>
 #include <string.h>
 #include <stdio.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
+#include <time.h>
 
-void tick_signal_init(TickSignal* sig) {
-    sig->head = 0;
-    sig->tail = 0;
-    sig->count = 0;
-    pthread_mutex_init(&sig->mutex, NULL);
-    pthread_cond_init(&sig->cond, NULL);
+static TickSignalSegment* tick_signal_new_segment(TickSignal* sig, uint64_t base) {
+    TickSignalSegment* seg = sig->free_list;
+    if (seg) {
+        sig->free_list = seg->free_next;
+    } else {
+        seg = (TickSignalSegment*)malloc(sizeof(TickSignalSegment));
+    }
+    for (uint32_t i = 0; i < SIGNAL_SEGMENT_SIZE; i++) {
+        atomic_store_explicit(&seg->slots[i].seq, base + i, memory_order_relaxed);
+        seg->slots[i].value = NULL;
+    }
+    atomic_store_explicit(&seg->consumed, 0, memory_order_relaxed);
+    seg->next = NULL;
+    seg->free_next = NULL;
+    atomic_store_explicit(&seg->base, base, memory_order_release);
+    return seg;
 }
 
-void tick_signal_emit(TickSignal* sig, void* value) {
-    pthread_mutex_lock(&sig->mutex);
+static TickSignalSegment* tick_signal_locate(TickSignal* sig, uint64_t ticket,
+                                             _Atomic(TickSignalSegment*)* hint) {
+    TickSignalSegment* seg = atomic_load_explicit(hint, memory_order_acquire);
+    if (seg) {
+        uint64_t base = atomic_load_explicit(&seg->base, memory_order_acquire);
+        if (ticket - base < SIGNAL_SEGMENT_SIZE) {
+            return seg;
+        }
+    }
 
-    if (sig->count < SIGNAL_QUEUE_SIZE) {
-        sig->data[sig->tail] = value;
-        sig->tail = (sig->tail + 1) % SIGNAL_QUEUE_SIZE;
-        sig->count++;
-        pthread_cond_signal(&sig->cond);
-    } else {
-        fprintf(stderr, "tick: signal queue full, value dropped\n");
+    pthread_mutex_lock(&sig->mutex);
+    seg = sig->seg_list;
+    TickSignalSegment* last = NULL;
+    while (seg) {
+        uint64_t base = atomic_load_explicit(&seg->base, memory_order_relaxed);
+        if (ticket - base < SIGNAL_SEGMENT_SIZE) {
+            atomic_store_explicit(hint, seg, memory_order_release);
+            pthread_mutex_unlock(&sig->mutex);
+            return seg;
+        }
+        last = seg;
+        seg = seg->next;
     }
 
+    uint64_t next_base = last
+        ? atomic_load_explicit(&last->base, memory_order_relaxed) + SIGNAL_SEGMENT_SIZE
+        : ticket - (ticket % SIGNAL_SEGMENT_SIZE);
+    do {
+        seg = tick_signal_new_segment(sig, next_base);
+        if (last) {
+            last->next = seg;
+        } else {
+            sig->seg_list = seg;
+        }
+        last = seg;
+        next_base += SIGNAL_SEGMENT_SIZE;
+    } while (ticket - atomic_load_explicit(&seg->base, memory_order_relaxed) >= SIGNAL_SEGMENT_SIZE);
+
+    atomic_store_explicit(hint, seg, memory_order_release);
     pthread_mutex_unlock(&sig->mutex);
+    return seg;
 }
 
-void* tick_signal_recv(TickSignal* sig) {
+static void tick_signal_retire(TickSignal* sig, TickSignalSegment* seg) {
     pthread_mutex_lock(&sig->mutex);
+    TickSignalSegment** link = &sig->seg_list;
+    while (*link && *link != seg) {
+        link = &(*link)->next;
+    }
+    if (*link) {
+        *link = seg->next;
+        TickSignalSegment* expected = seg;
+        atomic_compare_exchange_strong(&sig->produce_seg, &expected, seg->next);
+        expected = seg;
+        atomic_compare_exchange_strong(&sig->consume_seg, &expected, seg->next);
+        seg->free_next = sig->free_list;
+        sig->free_list = seg;
+    }
+    pthread_mutex_unlock(&sig->mutex);
+}
+
+void tick_signal_init(TickSignal* sig) {
+    atomic_store_explicit(&sig->tail, 0, memory_order_relaxed);
+    atomic_store_explicit(&sig->head, 0, memory_order_relaxed);
+    sig->seg_list = NULL;
+    sig->free_list = NULL;
+    atomic_store_explicit(&sig->waiters, 0, memory_order_relaxed);
+    atomic_store_explicit(&sig->depth_hwm, 0, memory_order_relaxed);
+    pthread_mutex_init(&sig->mutex, NULL);
+    pthread_cond_init(&sig->cond, NULL);
+    sig->seg_list = tick_signal_new_segment(sig, 0);
+    atomic_store_explicit(&sig->produce_seg, sig->seg_list, memory_order_relaxed);
+    atomic_store_explicit(&sig->consume_seg, sig->seg_list, memory_order_relaxed);
+}
+
+static void tick_signal_put(TickSignal* sig, uint64_t ticket, void* value) {
+    for (;;) {
+        TickSignalSegment* seg = tick_signal_locate(sig, ticket, &sig->produce_seg);
+        uint64_t base = atomic_load_explicit(&seg->base, memory_order_acquire);
+        if (ticket - base >= SIGNAL_SEGMENT_SIZE) {
+            continue;
+        }
+        TickSignalSlot* slot = &seg->slots[ticket - base];
+        if (atomic_load_explicit(&slot->seq, memory_order_acquire) != ticket) {
+            continue;
+        }
+        slot->value = value;
+        atomic_store_explicit(&slot->seq, ticket + 1, memory_order_release);
+        return;
+    }
+}
 
-    while (sig->count == 0) {
-        pthread_cond_wait(&sig->cond, &sig->mutex);
+static void tick_signal_wake(TickSignal* sig) {
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&sig->waiters, memory_order_relaxed) > 0) {
+        pthread_mutex_lock(&sig->mutex);
+        pthread_cond_broadcast(&sig->cond);
+        pthread_mutex_unlock(&sig->mutex);
     }
+}
 
-    void* value = sig->data[sig->head];
-    sig->head = (sig->head + 1) % SIGNAL_QUEUE_SIZE;
-    sig->count--;
+static void* tick_signal_take(TickSignal* sig, uint64_t ticket) {
+    TickSignalSegment* seg = tick_signal_locate(sig, ticket, &sig->consume_seg);
+    uint64_t base = atomic_load_explicit(&seg->base, memory_order_acquire);
+    TickSignalSlot* slot = &seg->slots[ticket - base];
 
-    pthread_mutex_unlock(&sig->mutex);
+    int spins = 0;
+    while (atomic_load_explicit(&slot->seq, memory_order_acquire) != ticket + 1) {
+        if (++spins < 1024) {
+            sched_yield();
+            continue;
+        }
+        atomic_fetch_add_explicit(&sig->waiters, 1, memory_order_seq_cst);
+        pthread_mutex_lock(&sig->mutex);
+        while (atomic_load_explicit(&slot->seq, memory_order_acquire) != ticket + 1) {
+            pthread_cond_wait(&sig->cond, &sig->mutex);
+        }
+        pthread_mutex_unlock(&sig->mutex);
+        atomic_fetch_sub_explicit(&sig->waiters, 1, memory_order_relaxed);
+    }
+
+    void* value = slot->value;
+    uint32_t done = atomic_fetch_add_explicit(&seg->consumed, 1, memory_order_acq_rel) + 1;
+    if (done == SIGNAL_SEGMENT_SIZE) {
+        tick_signal_retire(sig, seg);
+    }
     return value;
 }
 
+static void tick_signal_note_depth(TickSignal* sig, uint64_t tail_end) {
+    if (!atomic_load_explicit(&tick_prof_enabled, memory_order_relaxed)) return;
+    uint64_t head = atomic_load_explicit(&sig->head, memory_order_relaxed);
+    uint64_t depth = tail_end > head ? tail_end - head : 0;
+    uint64_t hwm = atomic_load_explicit(&sig->depth_hwm, memory_order_relaxed);
+    while (depth > hwm &&
+           !atomic_compare_exchange_weak_explicit(&sig->depth_hwm, &hwm, depth,
+               memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+void tick_signal_emit(TickSignal* sig, void* value) {
+    uint64_t ticket = atomic_fetch_add_explicit(&sig->tail, 1, memory_order_relaxed);
+    tick_signal_put(sig, ticket, value);
+    tick_signal_note_depth(sig, ticket + 1);
+    tick_signal_wake(sig);
+}
+
+void tick_signal_emit_n(TickSignal* sig, void** values, int32_t n) {
+    if (n <= 0) return;
+    uint64_t first = atomic_fetch_add_explicit(&sig->tail, (uint64_t)n, memory_order_relaxed);
+    for (int32_t i = 0; i < n; i++) {
+        tick_signal_put(sig, first + i, values[i]);
+    }
+    tick_signal_note_depth(sig, first + (uint64_t)n);
+    tick_signal_wake(sig);
+}
+
+void* tick_signal_recv(TickSignal* sig) {
+    uint64_t ticket = atomic_fetch_add_explicit(&sig->head, 1, memory_order_relaxed);
+    return tick_signal_take(sig, ticket);
+}
+
+void tick_signal_recv_n(TickSignal* sig, void** out, int32_t n) {
+    if (n <= 0) return;
+    uint64_t first = atomic_fetch_add_explicit(&sig->head, (uint64_t)n, memory_order_relaxed);
+    for (int32_t i = 0; i < n; i++) {
+        out[i] = tick_signal_take(sig, first + i);
+    }
+}
+
 void tick_signal_destroy(TickSignal* sig) {
+    TickSignalSegment* seg = sig->seg_list;
+    while (seg) {
+        TickSignalSegment* next = seg->next;
+        free(seg);
+        seg = next;
+    }
+    seg = sig->free_list;
+    while (seg) {
+        TickSignalSegment* next = seg->free_next;
+        free(seg);
+        seg = next;
+    }
     pthread_mutex_destroy(&sig->mutex);
     pthread_cond_destroy(&sig->cond);
 }
 
+typedef struct TickPoolTask {
+    TickProcessFunc func;
+    TickEvent* evt;
+    struct TickPoolTask* next;
+} TickPoolTask;
+
+static struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    TickPoolTask* head;
+    TickPoolTask* tail;
+    TickPoolTask* free_tasks;
+    int idle;
+    bool started;
+} tick_pool = {PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER,
+               NULL, NULL, NULL, 0, false};
+
+static void tick_pool_run_task(TickPoolTask* task) {
+    TickProcessFunc func = task->func;
+    TickEvent* evt = task->evt;
+
+    pthread_mutex_lock(&tick_pool.mutex);
+    task->next = tick_pool.free_tasks;
+    tick_pool.free_tasks = task;
+    pthread_mutex_unlock(&tick_pool.mutex);
+
+    func(NULL);
+
+    pthread_mutex_lock(&evt->mutex);
+    evt->pending--;
+    if (evt->pending == 0) {
+        pthread_cond_broadcast(&evt->cond);
+    }
+    pthread_mutex_unlock(&evt->mutex);
+}
+
+static void* tick_pool_worker(void* arg) {
+    (void)arg;
+    for (;;) {
+        pthread_mutex_lock(&tick_pool.mutex);
+        while (!tick_pool.head) {
+            tick_pool.idle++;
+            pthread_cond_wait(&tick_pool.cond, &tick_pool.mutex);
+            tick_pool.idle--;
+        }
+        TickPoolTask* task = tick_pool.head;
+        tick_pool.head = task->next;
+        if (!tick_pool.head) {
+            tick_pool.tail = NULL;
+        }
+        pthread_mutex_unlock(&tick_pool.mutex);
+
+        tick_pool_run_task(task);
+    }
+    return NULL;
+}
+
+static void tick_pool_spawn_worker(void) {
+    pthread_t thread;
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    pthread_create(&thread, &attr, tick_pool_worker, NULL);
+    pthread_attr_destroy(&attr);
+}
+
+static void tick_pool_submit(TickProcessFunc func, TickEvent* evt) {
+    pthread_mutex_lock(&tick_pool.mutex);
+    if (!tick_pool.started) {
+        tick_pool.started = true;
+        long cores = sysconf(_SC_NPROCESSORS_ONLN);
+        if (cores < 1) cores = 1;
+        for (long i = 0; i < cores; i++) {
+            tick_pool_spawn_worker();
+        }
+    }
+
+    TickPoolTask* task = tick_pool.free_tasks;
+    if (task) {
+        tick_pool.free_tasks = task->next;
+    } else {
+        task = (TickPoolTask*)malloc(sizeof(TickPoolTask));
+    }
+    task->func = func;
+    task->evt = evt;
+    task->next = NULL;
+    if (tick_pool.tail) {
+        tick_pool.tail->next = task;
+    } else {
+        tick_pool.head = task;
+    }
+    tick_pool.tail = task;
+
+    if (tick_pool.idle > 0) {
+        pthread_cond_signal(&tick_pool.cond);
+    } else {
+        tick_pool_spawn_worker();
+    }
+    pthread_mutex_unlock(&tick_pool.mutex);
+}
+
 void tick_event_init(TickEvent* evt, int capacity) {
     evt->process_funcs = (TickProcessFunc*)malloc(sizeof(TickProcessFunc) * capacity);
-    evt->threads = (pthread_t*)malloc(sizeof(pthread_t) * capacity);
     evt->process_count = 0;
+    evt->pending = 0;
+    pthread_mutex_init(&evt->mutex, NULL);
+    pthread_cond_init(&evt->cond, NULL);
 }
 
 void tick_event_add_process(TickEvent* evt, TickProcessFunc func) {
@@ -58,20 +328,54 @@ void tick_event_add_process(TickEvent* evt, TickProcessFunc func) {
 }
 
 void tick_event_execute(TickEvent* evt) {
+    pthread_mutex_lock(&evt->mutex);
+    evt->pending += evt->process_count;
+    pthread_mutex_unlock(&evt->mutex);
+
     for (int i = 0; i < evt->process_count; i++) {
-        pthread_create(&evt->threads[i], NULL, evt->process_funcs[i], NULL);
+        tick_pool_submit(evt->process_funcs[i], evt);
     }
 }
 
 void tick_event_wait(TickEvent* evt) {
-    for (int i = 0; i < evt->process_count; i++) {
-        pthread_join(evt->threads[i], NULL);
+    pthread_mutex_lock(&evt->mutex);
+    while (evt->pending > 0) {
+        pthread_cond_wait(&evt->cond, &evt->mutex);
     }
+    pthread_mutex_unlock(&evt->mutex);
 }
 
 void tick_event_destroy(TickEvent* evt) {
     free(evt->process_funcs);
-    free(evt->threads);
+    pthread_mutex_destroy(&evt->mutex);
+    pthread_cond_destroy(&evt->cond);
+}
+
+#define TICK_STR_ARENA_BLOCK (64 * 1024)
+
+typedef struct TickStrArenaBlock {
+    struct TickStrArenaBlock* next;
+    size_t used;
+    size_t cap;
+} TickStrArenaBlock;
+
+static __thread TickStrArenaBlock* tick_str_arena = NULL;
+
+static char* tick_str_alloc(size_t size) {
+    size = (size + 7) & ~(size_t)7;
+    TickStrArenaBlock* block = tick_str_arena;
+    if (!block || block->cap - block->used < size) {
+        size_t cap = TICK_STR_ARENA_BLOCK;
+        if (cap < size) cap = size;
+        block = (TickStrArenaBlock*)malloc(sizeof(TickStrArenaBlock) + cap);
+        block->next = tick_str_arena;
+        block->used = 0;
+        block->cap = cap;
+        tick_str_arena = block;
+    }
+    char* result = (char*)(block + 1) + block->used;
+    block->used += size;
+    return result;
 }
 
 int32_t tick_str_length(const char* s) {
@@ -84,21 +388,38 @@ char* tick_str_concat(const char* a, const char* b) {
     if (!b) b = "";
     size_t la = strlen(a);
     size_t lb = strlen(b);
-    char* result = (char*)malloc(la + lb + 1);
+    char* result = tick_str_alloc(la + lb + 1);
     memcpy(result, a, la);
     memcpy(result + la, b, lb);
     result[la + lb] = '\0';
     return result;
 }
 
+char* tick_str_concat_n(const char** parts, int32_t n) {
+    size_t lengths[16];
+    size_t total = 0;
+    for (int32_t i = 0; i < n; i++) {
+        lengths[i] = parts[i] ? strlen(parts[i]) : 0;
+        total += lengths[i];
+    }
+    char* result = tick_str_alloc(total + 1);
+    size_t pos = 0;
+    for (int32_t i = 0; i < n; i++) {
+        memcpy(result + pos, parts[i] ? parts[i] : "", lengths[i]);
+        pos += lengths[i];
+    }
+    result[total] = '\0';
+    return result;
+}
+
 char* tick_str_substring(const char* s, int32_t start, int32_t end) {
-    if (!s) { char* r = (char*)malloc(1); r[0] = '\0'; return r; }
+    if (!s) { char* r = tick_str_alloc(1); r[0] = '\0'; return r; }
     int32_t len = (int32_t)strlen(s);
     if (start < 0) start = 0;
     if (end > len) end = len;
-    if (start >= end) { char* r = (char*)malloc(1); r[0] = '\0'; return r; }
+    if (start >= end) { char* r = tick_str_alloc(1); r[0] = '\0'; return r; }
     int32_t sub_len = end - start;
-    char* result = (char*)malloc(sub_len + 1);
+    char* result = tick_str_alloc(sub_len + 1);
     memcpy(result, s + start, sub_len);
     result[sub_len] = '\0';
     return result;
@@ -124,7 +445,7 @@ char tick_str_char_at(const char* s, int32_t index) {
 }
 
 char* tick_str_from_i64(int64_t val) {
-    char* buf = (char*)malloc(32);
+    char* buf = tick_str_alloc(32);
     snprintf(buf, 32, "%lld", (long long)val);
     return buf;
 }
@@ -135,13 +456,13 @@ int64_t tick_str_to_i64(const char* s) {
 }
 
 char* tick_str_from_u64(uint64_t val) {
-    char* buf = (char*)malloc(32);
+    char* buf = tick_str_alloc(32);
     snprintf(buf, 32, "%llu", (unsigned long long)val);
     return buf;
 }
 
 char* tick_str_from_f64(double val) {
-    char* buf = (char*)malloc(64);
+    char* buf = tick_str_alloc(64);
     snprintf(buf, 64, "%f", val);
     return buf;
 }
@@ -152,7 +473,7 @@ double tick_str_to_f64(const char* s) {
 }
 
 char* tick_str_from_b8(bool val) {
-    char* buf = (char*)malloc(6);
+    char* buf = tick_str_alloc(6);
     snprintf(buf, 6, "%s", val ? "true" : "false");
     return buf;
 }
@@ -193,12 +514,62 @@ TickFile* tick_file_open(const char* path, const char* mode) {
 
 char* tick_file_read(TickFile* f) {
     if (!f || !f->handle) { char* r = (char*)malloc(1); r[0] = '\0'; return r; }
-    fseek(f->handle, 0, SEEK_END);
-    long size = ftell(f->handle);
-    fseek(f->handle, 0, SEEK_SET);
-    char* buf = (char*)malloc(size + 1);
-    fread(buf, 1, size, f->handle);
-    buf[size] = '\0';
+    struct stat st;
+    if (fstat(fileno(f->handle), &st) != 0) { char* r = (char*)malloc(1); r[0] = '\0'; return r; }
+    char* buf = (char*)malloc((size_t)st.st_size + 1);
+    size_t got = fread(buf, 1, (size_t)st.st_size, f->handle);
+    buf[got] = '\0';
+    return buf;
+}
+
+char* tick_file_read_line(TickFile* f) {
+    static __thread char* line_buf = NULL;
+    static __thread size_t line_cap = 0;
+    if (!f || !f->handle) { char* r = tick_str_alloc(1); r[0] = '\0'; return r; }
+    ssize_t got = getline(&line_buf, &line_cap, f->handle);
+    if (got < 0) { char* r = tick_str_alloc(1); r[0] = '\0'; return r; }
+    while (got > 0 && (line_buf[got - 1] == '\n' || line_buf[got - 1] == '\r')) {
+        got--;
+    }
+    char* result = tick_str_alloc((size_t)got + 1);
+    memcpy(result, line_buf, (size_t)got);
+    result[got] = '\0';
+    return result;
+}
+
+char* tick_file_read_chunk(TickFile* f, int32_t n) {
+    if (!f || !f->handle || n <= 0) { char* r = tick_str_alloc(1); r[0] = '\0'; return r; }
+    char* buf = tick_str_alloc((size_t)n + 1);
+    size_t got = fread(buf, 1, (size_t)n, f->handle);
+    buf[got] = '\0';
+    return buf;
+}
+
+char* tick_file_mmap(const char* path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) { char* r = tick_str_alloc(1); r[0] = '\0'; return r; }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        char* r = tick_str_alloc(1);
+        r[0] = '\0';
+        return r;
+    }
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    if ((size_t)st.st_size % page != 0) {
+        char* data = (char*)mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (data != MAP_FAILED) {
+            return data;
+        }
+        fd = open(path, O_RDONLY);
+        if (fd < 0) { char* r = tick_str_alloc(1); r[0] = '\0'; return r; }
+    }
+    char* buf = (char*)malloc((size_t)st.st_size + 1);
+    ssize_t got = read(fd, buf, (size_t)st.st_size);
+    close(fd);
+    if (got < 0) got = 0;
+    buf[got] = '\0';
     return buf;
 }
 
@@ -213,17 +584,131 @@ void tick_file_close(TickFile* f) {
     free(f);
 }
 
+typedef struct TickAioOp {
+    char* path;
+    char* data;
+    TickSignal* sig;
+    bool is_write;
+    struct TickAioOp* next;
+} TickAioOp;
+
+static struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    TickAioOp* head;
+    TickAioOp* tail;
+    bool started;
+} tick_aio = {PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, NULL, NULL, false};
+
+static void* tick_aio_worker(void* arg) {
+    (void)arg;
+    for (;;) {
+        pthread_mutex_lock(&tick_aio.mutex);
+        while (!tick_aio.head) {
+            pthread_cond_wait(&tick_aio.cond, &tick_aio.mutex);
+        }
+        TickAioOp* op = tick_aio.head;
+        tick_aio.head = op->next;
+        if (!tick_aio.head) {
+            tick_aio.tail = NULL;
+        }
+        pthread_mutex_unlock(&tick_aio.mutex);
+
+        if (op->is_write) {
+            int fd = open(op->path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            ssize_t written = -1;
+            if (fd >= 0) {
+                size_t len = strlen(op->data);
+                written = write(fd, op->data, len);
+                close(fd);
+            }
+            tick_signal_emit(op->sig, (void*)(intptr_t)(written < 0 ? -1 : (int32_t)written));
+        } else {
+            char* buf = NULL;
+            int fd = open(op->path, O_RDONLY);
+            if (fd >= 0) {
+                struct stat st;
+                if (fstat(fd, &st) == 0) {
+                    buf = (char*)malloc((size_t)st.st_size + 1);
+                    ssize_t got = read(fd, buf, (size_t)st.st_size);
+                    buf[got < 0 ? 0 : got] = '\0';
+                }
+                close(fd);
+            }
+            if (!buf) {
+                buf = (char*)malloc(1);
+                buf[0] = '\0';
+            }
+            tick_signal_emit(op->sig, buf);
+        }
+
+        free(op->path);
+        free(op->data);
+        free(op);
+    }
+    return NULL;
+}
+
+static void tick_aio_submit(const char* path, const char* data, TickSignal* sig, bool is_write) {
+    TickAioOp* op = (TickAioOp*)malloc(sizeof(TickAioOp));
+    op->path = strdup(path ? path : "");
+    op->data = data ? strdup(data) : NULL;
+    op->sig = sig;
+    op->is_write = is_write;
+    op->next = NULL;
+
+    pthread_mutex_lock(&tick_aio.mutex);
+    if (!tick_aio.started) {
+        tick_aio.started = true;
+        pthread_t thread;
+        pthread_attr_t attr;
+        pthread_attr_init(&attr);
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+        pthread_create(&thread, &attr, tick_aio_worker, NULL);
+        pthread_attr_destroy(&attr);
+    }
+    if (tick_aio.tail) {
+        tick_aio.tail->next = op;
+    } else {
+        tick_aio.head = op;
+    }
+    tick_aio.tail = op;
+    pthread_cond_signal(&tick_aio.cond);
+    pthread_mutex_unlock(&tick_aio.mutex);
+}
+
+void tick_file_read_async(const char* path, TickSignal* sig) {
+    tick_aio_submit(path, NULL, sig, false);
+}
+
+void tick_file_write_async(const char* path, const char* data, TickSignal* sig) {
+    tick_aio_submit(path, data, sig, true);
+}
+
 bool tick_file_exists(const char* path) {
     if (!path) return false;
     struct stat st;
     return stat(path, &st) == 0;
 }
 
+void tick_array_reserve(TickArray* arr, size_t elem_size, int32_t n) {
+    if (n <= arr->cap) return;
+    int32_t new_cap = (arr->cap < 16) ? 16 : arr->cap;
+    while (new_cap < n) new_cap *= 2;
+    arr->ptr = realloc(arr->ptr, (size_t)new_cap * elem_size);
+    arr->cap = new_cap;
+}
+
+void tick_array_append_n(TickArray* arr, size_t elem_size, const void* src, int32_t count) {
+    if (count <= 0) return;
+    tick_array_reserve(arr, elem_size, arr->len + count);
+    memcpy((char*)arr->ptr + (size_t)arr->len * elem_size, src, (size_t)count * elem_size);
+    arr->len += count;
+}
+
 void tick_array_push(TickArray* arr, size_t elem_size) {
     if (arr->len >= arr->cap) {
-        int32_t new_cap = (arr->cap == 0) ? 4 : (arr->cap * 2);
-        arr->ptr = realloc(arr->ptr, (size_t)new_cap * elem_size);
-        arr->cap = new_cap;
+        tick_array_reserve(arr, elem_size, arr->len + 1);
     }
     arr->len++;
 }
@@ -231,3 +716,83 @@ void tick_array_push(TickArray* arr, size_t elem_size) {
 void tick_array_pop(TickArray* arr) {
     if (arr->len > 0) arr->len--;
 }
+
+_Atomic int tick_prof_enabled = 0;
+
+typedef struct TickProfSignal {
+    TickSignal* sig;
+    const char* name;
+    struct TickProfSignal* next;
+} TickProfSignal;
+
+static pthread_mutex_t tick_prof_mutex = PTHREAD_MUTEX_INITIALIZER;
+static TickProfCounter* tick_prof_counters = NULL;
+static TickProfSignal* tick_prof_signals = NULL;
+
+uint64_t tick_prof_cycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+TickProfScope tick_prof_scope_begin(TickProfCounter* counter) {
+    if (!atomic_load_explicit(&counter->registered, memory_order_acquire)) {
+        pthread_mutex_lock(&tick_prof_mutex);
+        if (!atomic_load_explicit(&counter->registered, memory_order_relaxed)) {
+            counter->next = tick_prof_counters;
+            tick_prof_counters = counter;
+            atomic_store_explicit(&counter->registered, 1, memory_order_release);
+        }
+        pthread_mutex_unlock(&tick_prof_mutex);
+    }
+    TickProfScope scope = { counter, tick_prof_cycles() };
+    return scope;
+}
+
+void tick_prof_scope_end(TickProfScope* scope) {
+    atomic_fetch_add_explicit(&scope->counter->calls, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&scope->counter->cycles,
+        tick_prof_cycles() - scope->start, memory_order_relaxed);
+}
+
+void tick_prof_register_signal(TickSignal* sig, const char* name) {
+    pthread_mutex_lock(&tick_prof_mutex);
+    for (TickProfSignal* ps = tick_prof_signals; ps; ps = ps->next) {
+        if (ps->sig == sig) {
+            pthread_mutex_unlock(&tick_prof_mutex);
+            return;
+        }
+    }
+    TickProfSignal* ps = malloc(sizeof(TickProfSignal));
+    ps->sig = sig;
+    ps->name = name;
+    ps->next = tick_prof_signals;
+    tick_prof_signals = ps;
+    pthread_mutex_unlock(&tick_prof_mutex);
+}
+
+static void tick_prof_dump(void) {
+    fprintf(stderr, "=== Tick Profile ===\n");
+    fprintf(stderr, "%-32s %12s %16s %12s\n", "function", "calls", "cycles", "cycles/call");
+    for (TickProfCounter* c = tick_prof_counters; c; c = c->next) {
+        uint64_t calls = atomic_load_explicit(&c->calls, memory_order_relaxed);
+        uint64_t cycles = atomic_load_explicit(&c->cycles, memory_order_relaxed);
+        fprintf(stderr, "%-32s %12llu %16llu %12llu\n", c->name,
+            (unsigned long long)calls, (unsigned long long)cycles,
+            (unsigned long long)(calls ? cycles / calls : 0));
+    }
+    for (TickProfSignal* ps = tick_prof_signals; ps; ps = ps->next) {
+        fprintf(stderr, "signal %-25s depth high-water %llu\n", ps->name,
+            (unsigned long long)atomic_load_explicit(&ps->sig->depth_hwm,
+                memory_order_relaxed));
+    }
+}
+
+void tick_prof_enable(void) {
+    if (atomic_exchange_explicit(&tick_prof_enabled, 1, memory_order_relaxed)) return;
+    atexit(tick_prof_dump);
+}
@@ -2,17 +2,35 @@
 #define TICK_RUNTIME_H
 
 #include <pthread.h>
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 
-#define SIGNAL_QUEUE_SIZE 1024
+#define SIGNAL_SEGMENT_SIZE 1024
 
 typedef struct {
-    void* data[SIGNAL_QUEUE_SIZE];
-    int head;
-    int tail;
-    int count;
+    _Atomic uint64_t seq;
+    void* value;
+} TickSignalSlot;
+
+typedef struct TickSignalSegment {
+    _Atomic uint64_t base;
+    _Atomic uint32_t consumed;
+    struct TickSignalSegment* next;
+    struct TickSignalSegment* free_next;
+    TickSignalSlot slots[SIGNAL_SEGMENT_SIZE];
+} TickSignalSegment;
+
+typedef struct {
+    _Atomic uint64_t tail;
+    _Atomic uint64_t head;
+    _Atomic(TickSignalSegment*) produce_seg;
+    _Atomic(TickSignalSegment*) consume_seg;
+    TickSignalSegment* seg_list;
+    TickSignalSegment* free_list;
+    _Atomic int waiters;
+    _Atomic uint64_t depth_hwm;
     pthread_mutex_t mutex;
     pthread_cond_t cond;
 } TickSignal;
@@ -22,7 +40,9 @@ typedef void* (*TickProcessFunc)(void*);
 typedef struct {
     TickProcessFunc* process_funcs;
     int process_count;
-    pthread_t* threads;
+    int pending;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
 } TickEvent;
 
 typedef struct {
@@ -31,7 +51,9 @@ typedef struct {
 
 void tick_signal_init(TickSignal* sig);
 void tick_signal_emit(TickSignal* sig, void* value);
+void tick_signal_emit_n(TickSignal* sig, void** values, int32_t n);
 void* tick_signal_recv(TickSignal* sig);
+void tick_signal_recv_n(TickSignal* sig, void** out, int32_t n);
 void tick_signal_destroy(TickSignal* sig);
 
 void tick_event_init(TickEvent* evt, int capacity);
@@ -42,6 +64,7 @@ void tick_event_destroy(TickEvent* evt);
 
 int32_t tick_str_length(const char* s);
 char* tick_str_concat(const char* a, const char* b);
+char* tick_str_concat_n(const char** parts, int32_t n);
 char* tick_str_substring(const char* s, int32_t start, int32_t end);
 int32_t tick_str_index_of(const char* s, const char* substr);
 int32_t tick_str_compare(const char* a, const char* b);
@@ -58,9 +81,14 @@ char* tick_input_readline(const char* prompt);
 
 TickFile* tick_file_open(const char* path, const char* mode);
 char* tick_file_read(TickFile* f);
+char* tick_file_read_line(TickFile* f);
+char* tick_file_read_chunk(TickFile* f, int32_t n);
+char* tick_file_mmap(const char* path);
 void tick_file_write(TickFile* f, const char* data);
 void tick_file_close(TickFile* f);
 bool tick_file_exists(const char* path);
+void tick_file_read_async(const char* path, TickSignal* sig);
+void tick_file_write_async(const char* path, const char* data, TickSignal* sig);
 
 typedef struct {
     void* ptr;
@@ -68,7 +96,29 @@ typedef struct {
     int32_t cap;
 } TickArray;
 
+void tick_array_reserve(TickArray* arr, size_t elem_size, int32_t n);
+void tick_array_append_n(TickArray* arr, size_t elem_size, const void* src, int32_t count);
 void tick_array_push(TickArray* arr, size_t elem_size);
 void tick_array_pop(TickArray* arr);
 
+typedef struct TickProfCounter {
+    const char* name;
+    _Atomic uint64_t calls;
+    _Atomic uint64_t cycles;
+    _Atomic int registered;
+    struct TickProfCounter* next;
+} TickProfCounter;
+
+typedef struct {
+    TickProfCounter* counter;
+    uint64_t start;
+} TickProfScope;
+
+extern _Atomic int tick_prof_enabled;
+void tick_prof_enable(void);
+uint64_t tick_prof_cycles(void);
+TickProfScope tick_prof_scope_begin(TickProfCounter* counter);
+void tick_prof_scope_end(TickProfScope* scope);
+void tick_prof_register_signal(TickSignal* sig, const char* name);
+
 #endif